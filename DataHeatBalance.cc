@@ -1,5 +1,6 @@
 // C++ Headers
 #include <cmath>
+#include <string>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -254,6 +255,23 @@ namespace DataHeatBalance {
 	//Parameters for checking surface heat transfer models
 	Real64 const HighDiffusivityThreshold( 1.e-5 ); // used to check if Material properties are out of line.
 	Real64 const ThinMaterialLayerThreshold( 0.003 ); // 3 mm lower limit to expected material layers
+
+	// Parameters for ScreenTransMethod (PerformancePrecisionTradeoffs)
+	int const ScreenTransMethodExact( 1 );
+	int const ScreenTransMethodTableLookup( 2 );
+
+	// Parameters for InsideSurfTempPredictor (PerformancePrecisionTradeoffs)
+	int const InsideSurfTempPredictorNone( 1 ); // Start from the last converged inside surface temperatures
+	int const InsideSurfTempPredictorLinear( 2 ); // Extrapolate from the last two converged timesteps
+	int const InsideSurfTempPredictorQuadratic( 3 ); // Extrapolate from the last three converged timesteps
+
+	// Parameters for SurfaceCaptureMode (Output:SurfaceHeatBalanceCapture)
+	int const SurfaceCaptureNone( 1 );
+	int const SurfaceCaptureWrite( 2 ); // Write the surface heat balance inputs and outputs at the chosen timestep
+	int const SurfaceCaptureReplay( 3 ); // Replay a capture at the chosen timestep
+
+	// Window screen beam property tables
+	int const NumScreenTableAngles( 181 ); // Table nodes over 0-90 deg of relative azimuth and altitude (0.5 deg spacing)
 	
 	//Parameter to choose between EcoRoof and GreenRoof_with_PlantCoverage (Jainam Shah 2014)
 	bool GreenRoofModel_PC( false ); //FALSE means use EcoRoof model Instead
@@ -367,6 +385,26 @@ namespace DataHeatBalance {
 	int TotScreens( 0 ); // Total number of exterior window screen materials
 	int TotTCGlazings( 0 ); // Number of TC glazing object - WindowMaterial:Glazing:Thermochromic found in the idf file
 	int NumSurfaceScreens( 0 ); // Total number of screens on exterior windows
+	int ScreenTransMethod( ScreenTransMethodExact ); // ScreenTransMethodExact or ScreenTransMethodTableLookup
+	int InsideSurfTempPredictor( InsideSurfTempPredictorNone ); // InsideSurfTempPredictorNone, ...Linear or ...Quadratic
+	int SurfaceCaptureMode( SurfaceCaptureNone ); // SurfaceCaptureNone, ...Write or ...Replay
+	std::string SurfaceCaptureFileName; // Capture file of Output:SurfaceHeatBalanceCapture
+	int SurfaceCaptureDay( 1 ); // Day of simulation of the captured zone timestep
+	int SurfaceCaptureHour( 12 ); // Hour of day of the captured zone timestep
+	int SurfaceCaptureTimeStep( 1 ); // Zone timestep within the hour of the captured zone timestep
+	int SurfaceCaptureRepetitions( 1000 ); // Surface heat balance repetitions of a replay
+	std::string HeatBalanceScalingFileName; // CSV file of Output:HeatBalanceScaling (blank = none)
+	std::string HeatBalanceScalingCase; // Case label of the rows this run adds to it
+	bool TimeDecompositionUsed( false ); // True if HeatBalance:TimeDecomposition is in the input
+	std::string CheckpointFilePrefix; // Prefix of the chunk boundary checkpoints of this run
+	std::string CheckpointReferencePrefix; // Prefix of the checkpoints of a serial reference run
+	int ChunkLength( 0 ); // Days between chunk boundaries
+	int ChunkNumber( 0 ); // Chunk simulated by this run (0 = the whole run period, serially)
+	int ChunkOverlapDays( 0 ); // Days simulated before the start of the chunk
+	int TotParametricVariants( 0 ); // Number of HeatBalance:ParametricVariant objects
+	int MaxConcurrentVariants( 0 ); // Variants run at the same time (0 = number of processors)
+	int ParametricVariantNum( 0 ); // Variant simulated by this process (0 = the base case)
+	FArray1D_int ScreenBmTransTablePtr; // Index into ScreenBmTransTable for each SurfaceScreens entry
 	int TotShades( 0 ); // Total number of shade materials
 	int TotComplexShades( 0 ); // Total number of shading materials for complex fenestrations
 	int TotComplexGaps( 0 ); // Total number of window gaps for complex fenestrations
@@ -497,6 +535,10 @@ namespace DataHeatBalance {
 	FArray1D< Real64 > NominalRforNominalUCalculation; // Nominal R values are summed to calculate NominalU values for constructions
 	FArray1D< Real64 > NominalU; // Nominal U value for each construction -- used in matching interzone surfaces
 
+	// Reverse construction lookup (interzone surfaces)
+	std::unordered_map< std::string, int > ConstructLayerSignatureMap; // layer signature -> first construction with those layers
+	int NumConstructsInLayerSignatureMap( 0 ); // Constructions 1..this value have been entered into ConstructLayerSignatureMap
+
 	// removed variables (these were all arrays):
 	//REAL(r64), ALLOCATABLE, :: DifIncInsSurfIntensRep    !Diffuse sol irradiance from ext wins on inside of surface (W/m2)
 	//REAL(r64), ALLOCATABLE, :: DifIncInsSurfAmountRep    !Diffuse sol amount from ext wins on inside of surface (W)
@@ -602,6 +644,8 @@ namespace DataHeatBalance {
 	FArray1D< WindowThermalModelParams > WindowThermalModel;
 	FArray1D< SurfaceScreenProperties > SurfaceScreens;
 	FArray1D< ScreenTransData > ScreenTrans;
+	FArray1D< ScreenBmTransTableData > ScreenBmTransTable;
+	FArray1D< ParametricVariantData > ParametricVariant;
 	FArray1D< ZoneCatEUseData > ZoneIntEEuse;
 	FArray1D< RefrigCaseCreditData > RefrigCaseCredit;
 	FArray1D< HeatReclaimRefrigeratedRackData > HeatReclaimRefrigeratedRack;
@@ -1073,7 +1117,6 @@ namespace DataHeatBalance {
 		static FArray1D_int LayerPoint( MaxLayersInConstruct, 0 ); // Pointer array which refers back to
 		int nLayer;
 		int Loop;
-		bool Found;
 
 		if ( ConstrNum == 0 ) {
 			// error caught elsewhere
@@ -1089,29 +1132,24 @@ namespace DataHeatBalance {
 			LayerPoint( nLayer ) = Construct( ConstrNum ).LayerPoint( Loop );
 		}
 
-		// now, got thru and see if there is a match already....
-		NewConstrNum = 0;
-		for ( Loop = 1; Loop <= TotConstructs; ++Loop ) {
-			Found = true;
-			for ( nLayer = 1; nLayer <= MaxLayersInConstruct; ++nLayer ) {
-				if ( Construct( Loop ).LayerPoint( nLayer ) != LayerPoint( nLayer ) ) {
-					Found = false;
-					break;
-				}
-			}
-			if ( Found ) {
-				NewConstrNum = Loop;
-				break;
-			}
+		// now, go thru and see if there is a match already....
+		// Constructions added since the last call (by any routine) are entered into the signature map first.
+		// Only the first construction with a given layer set is kept, which matches the old linear search.
+		for ( Loop = NumConstructsInLayerSignatureMap + 1; Loop <= TotConstructs; ++Loop ) {
+			ConstructLayerSignatureMap.emplace( ConstructionLayerSignature( Construct( Loop ).LayerPoint ), Loop );
 		}
+		NumConstructsInLayerSignatureMap = TotConstructs;
+
+		NewConstrNum = 0;
+		std::string const ReverseSignature( ConstructionLayerSignature( LayerPoint ) );
+		auto const Match( ConstructLayerSignatureMap.find( ReverseSignature ) );
+		if ( Match != ConstructLayerSignatureMap.end() ) NewConstrNum = Match->second;
 
 		// if need new one, bunch o stuff
 		if ( NewConstrNum == 0 ) {
+			ReserveConstructionStorage( TotConstructs + 1 );
 			++TotConstructs;
-			Construct.redimension( TotConstructs );
-			NominalRforNominalUCalculation.redimension( TotConstructs );
 			NominalRforNominalUCalculation( TotConstructs ) = 0.0;
-			NominalU.redimension( TotConstructs );
 			NominalU( TotConstructs ) = 0.0;
 			//  Put in new attributes
 			NewConstrNum = TotConstructs;
@@ -1135,12 +1173,98 @@ namespace DataHeatBalance {
 
 			CheckAndSetConstructionProperties( TotConstructs, ErrorsFound );
 
+			ConstructLayerSignatureMap.emplace( ReverseSignature, TotConstructs );
+			NumConstructsInLayerSignatureMap = TotConstructs;
+
 		}
 
 		return NewConstrNum;
 
 	}
 
+	std::string
+	ConstructionLayerSignature( FArray1_int const & LayerPoint ) // Layer pointers of a construction
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Builds the key used in ConstructLayerSignatureMap.  Two constructions have the same
+		// signature exactly when all MaxLayersInConstruct layer pointers are equal.
+
+		// Return value
+		std::string Signature;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Layer;
+
+		Signature.reserve( MaxLayersInConstruct * 4 );
+		for ( Layer = 1; Layer <= MaxLayersInConstruct; ++Layer ) {
+			Signature += std::to_string( LayerPoint( Layer ) );
+			Signature += ',';
+		}
+
+		return Signature;
+
+	}
+
+	void
+	ReserveConstructionStorage( int const NumConstructsNeeded ) // Number of constructions that must fit
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Makes sure Construct, NominalRforNominalUCalculation and NominalU can hold NumConstructsNeeded
+		// entries.  Each ConstructionData carries many arrays, so growing by one entry at a time copies
+		// the whole table for every new construction.
+
+		// METHODOLOGY EMPLOYED:
+		// Capacity is doubled when it runs out.  Entries past TotConstructs are default constructed and
+		// unused; TrimConstructionStorage releases them once surface input is done.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Capacity; // Current allocated size of Construct
+		int NewCapacity; // Allocated size after growth
+
+		Capacity = static_cast< int >( Construct.size() );
+		if ( NumConstructsNeeded <= Capacity ) return;
+
+		NewCapacity = max( NumConstructsNeeded, 2 * Capacity );
+		Construct.redimension( NewCapacity );
+		NominalRforNominalUCalculation.redimension( NewCapacity, 0.0 );
+		NominalU.redimension( NewCapacity, 0.0 );
+
+	}
+
+	void
+	TrimConstructionStorage()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Drops the spare capacity left by ReserveConstructionStorage so that the construction
+		// arrays are again sized to TotConstructs.
+
+		if ( static_cast< int >( Construct.size() ) > TotConstructs ) Construct.redimension( TotConstructs );
+		if ( static_cast< int >( NominalRforNominalUCalculation.size() ) > TotConstructs ) NominalRforNominalUCalculation.redimension( TotConstructs );
+		if ( static_cast< int >( NominalU.size() ) > TotConstructs ) NominalU.redimension( TotConstructs );
+
+	}
+
 	void
 	AddVariableSlatBlind(
 		int const inBlindNumber, // current Blind Number/pointer to name
@@ -1248,6 +1372,146 @@ namespace DataHeatBalance {
 
 	}
 
+	void
+	CalcScreenBmTransComponents(
+		int const ScNum, // Index to screen data
+		Real64 const SunAzimuthToScreenNormal, // Relative solar azimuth (rad)
+		Real64 const SunAltitudeToScreenNormal, // Relative solar altitude (rad)
+		Real64 & Tdirect, // Beam solar transmitted through screen
+		Real64 & Tscattered, // Beam solar reflected through screen
+		Real64 & TscatteredVis // Visible beam solar reflected through screen
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Richard Raustad
+		//       DATE WRITTEN   May 2006
+		//       MODIFIED       Oct 2026, split out of CalcScreenTransmittance
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//  Calculate the sun angle dependent direct and scattered beam transmittance of a window screen.
+		//  These depend only on the screen geometry and material reflectance, so they are also used to
+		//  fill the ScreenBmTransTable when table lookup is requested.
+
+		// Using/Aliasing
+		using DataGlobals::PiOvr2;
+		using DataGlobals::DegToRadians;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const Small( 1.E-9 ); // Small Number used to approximate zero
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 Beta; // Compliment of relative solar azimuth (rad)
+		Real64 TransXDir; // Horizontal component of direct beam transmittance
+		Real64 TransYDir; // Vertical component of direct beam transmittance
+		Real64 Delta; // Intermediate variable used for Tscatter calculation (deg)
+		Real64 DeltaMax; // Intermediate variable used for Tscatter calculation (deg)
+		Real64 Tscattermax; // Maximum solar beam  scattered transmittance
+		Real64 TscattermaxVis; // Maximum visible beam scattered transmittance
+		Real64 ExponentInterior; // Exponent used in scattered transmittance calculation
+		// when Delta < DeltaMax (0,0 to peak)
+		Real64 ExponentExterior; // Exponent used in scattered transmittance calculation
+		// when Delta > DeltaMax (peak to max)
+		Real64 AlphaDblPrime; // Intermediate variables (used in Eng. Doc.)
+		Real64 COSMu;
+		Real64 Epsilon;
+		Real64 Eta;
+		Real64 MuPrime;
+		Real64 Gamma;
+		Real64 PeakToPlateauRatio; // Ratio of peak scattering to plateau at 0,0 incident angle
+		Real64 PeakToPlateauRatioVis; // Ratio of peak visible scattering to plateau at 0,0 incident angle
+		Real64 ReflectCyl; // Screen material reflectance
+		Real64 ReflectCylVis; // Screen material visible reflectance
+
+		// ratio of screen material diameter to screen material spacing
+		Gamma = SurfaceScreens( ScNum ).ScreenDiameterToSpacingRatio;
+
+		// ************************************************************************************************
+		// * calculate transmittance of totally absorbing screen material (beam passing through open area)*
+		// ************************************************************************************************
+
+		// calculate compliment of relative solar azimuth
+		Beta = PiOvr2 - SunAzimuthToScreenNormal;
+
+		// Catch all divide by zero instances
+		if ( Beta > Small ) {
+			if ( std::abs( SunAltitudeToScreenNormal - PiOvr2 ) > Small ) {
+				AlphaDblPrime = std::atan( std::tan( SunAltitudeToScreenNormal ) / std::cos( SunAzimuthToScreenNormal ) );
+				TransYDir = 1.0 - Gamma * ( std::cos( AlphaDblPrime ) + std::sin( AlphaDblPrime ) * std::tan( SunAltitudeToScreenNormal ) * std::sqrt( 1.0 + pow_2( 1.0 / std::tan( Beta ) ) ) );
+				TransYDir = max( 0.0, TransYDir );
+			} else {
+				TransYDir = 0.0;
+			}
+		} else {
+			TransYDir = 0.0;
+		}
+
+		COSMu = std::sqrt( pow_2( std::cos( SunAltitudeToScreenNormal ) ) * pow_2( std::cos( SunAzimuthToScreenNormal ) ) + pow_2( std::sin( SunAltitudeToScreenNormal ) ) );
+		if ( COSMu > Small ) {
+			Epsilon = std::acos( std::cos( SunAltitudeToScreenNormal ) * std::cos( SunAzimuthToScreenNormal ) / COSMu );
+			Eta = PiOvr2 - Epsilon;
+			if ( std::cos( Epsilon ) != 0.0 ) {
+				MuPrime = std::atan( std::tan( std::acos( COSMu ) ) / std::cos( Epsilon ) );
+				if ( Eta != 0.0 ) {
+					TransXDir = 1.0 - Gamma * ( std::cos( MuPrime ) + std::sin( MuPrime ) * std::tan( std::acos( COSMu ) ) * std::sqrt( 1.0 + pow_2( 1.0 / std::tan( Eta ) ) ) );
+					TransXDir = max( 0.0, TransXDir );
+				} else {
+					TransXDir = 0.0;
+				}
+			} else {
+				TransXDir = 0.0;
+			}
+		} else {
+			TransXDir = 1.0 - Gamma;
+		}
+		Tdirect = max( 0.0, TransXDir * TransYDir );
+
+		// *******************************************************************************
+		// * calculate transmittance of scattered beam due to reflecting screen material *
+		// *******************************************************************************
+
+		ReflectCyl = SurfaceScreens( ScNum ).ReflectCylinder;
+		ReflectCylVis = SurfaceScreens( ScNum ).ReflectCylinderVis;
+
+		if ( std::abs( SunAzimuthToScreenNormal - PiOvr2 ) < Small || std::abs( SunAltitudeToScreenNormal - PiOvr2 ) < Small ) {
+			Tscattered = 0.0;
+			TscatteredVis = 0.0;
+		} else {
+			//   DeltaMax and Delta are in degrees
+			DeltaMax = 89.7 - ( 10.0 * Gamma / 0.16 );
+			Delta = std::sqrt( pow_2( SunAzimuthToScreenNormal / DegToRadians ) + pow_2( SunAltitudeToScreenNormal / DegToRadians ) );
+
+			//   Use empirical model to determine maximum (peak) scattering
+			Tscattermax = 0.0229 * Gamma + 0.2971 * ReflectCyl - 0.03624 * pow_2( Gamma ) + 0.04763 * pow_2( ReflectCyl ) - 0.44416 * Gamma * ReflectCyl;
+			TscattermaxVis = 0.0229 * Gamma + 0.2971 * ReflectCylVis - 0.03624 * pow_2( Gamma ) + 0.04763 * pow_2( ReflectCylVis ) - 0.44416 * Gamma * ReflectCylVis;
+
+			//   Vary slope of interior and exterior surface of scattering model
+			ExponentInterior = -pow_2( Delta - DeltaMax ) / 600.0;
+			ExponentExterior = -std::pow( std::abs( Delta - DeltaMax ), 2.5 ) / 600.0;
+
+			//   Determine ratio of scattering at 0,0 incident angle to maximum (peak) scattering
+			PeakToPlateauRatio = 1.0 / ( 0.2 * ( 1 - Gamma ) * ReflectCyl );
+			PeakToPlateauRatioVis = 1.0 / ( 0.2 * ( 1 - Gamma ) * ReflectCylVis );
+
+			if ( Delta > DeltaMax ) {
+				//     Apply offset for plateau and use exterior exponential function to simulate actual scattering as a function of solar angles
+				Tscattered = 0.2 * ( 1.0 - Gamma ) * ReflectCyl * Tscattermax * ( 1.0 + ( PeakToPlateauRatio - 1.0 ) * std::exp( ExponentExterior ) );
+				TscatteredVis = 0.2 * ( 1.0 - Gamma ) * ReflectCylVis * TscattermaxVis * ( 1.0 + ( PeakToPlateauRatioVis - 1.0 ) * std::exp( ExponentExterior ) );
+				//     Trim off offset if solar angle (delta) is greater than maximum (peak) scattering angle
+				Tscattered -= ( 0.2 * ( 1.0 - Gamma ) * ReflectCyl * Tscattermax ) * max( 0.0, ( Delta - DeltaMax ) / ( 90.0 - DeltaMax ) );
+				TscatteredVis -= ( 0.2 * ( 1.0 - Gamma ) * ReflectCylVis * TscattermaxVis ) * max( 0.0, ( Delta - DeltaMax ) / ( 90.0 - DeltaMax ) );
+			} else {
+				//     Apply offset for plateau and use interior exponential function to simulate actual scattering as a function of solar angles
+				Tscattered = 0.2 * ( 1.0 - Gamma ) * ReflectCyl * Tscattermax * ( 1.0 + ( PeakToPlateauRatio - 1.0 ) * std::exp( ExponentInterior ) );
+				TscatteredVis = 0.2 * ( 1.0 - Gamma ) * ReflectCylVis * TscattermaxVis * ( 1.0 + ( PeakToPlateauRatioVis - 1.0 ) * std::exp( ExponentInterior ) );
+			}
+		}
+		Tscattered = max( 0.0, Tscattered );
+		TscatteredVis = max( 0.0, TscatteredVis );
+
+	}
+
 	void
 	CalcScreenTransmittance(
 		int const SurfaceNum,
@@ -1260,7 +1524,7 @@ namespace DataHeatBalance {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Richard Raustad
 		//       DATE WRITTEN   May 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, optional table lookup of the angle dependent terms
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1294,6 +1558,10 @@ namespace DataHeatBalance {
 		//  CALL's passing the screen number without the relative azimuth and altitude angles is not allowed
 		//  CALL CalcScreenTransmittance(0, ScreenNumber=ScNum) ! DO NOT use this syntax
 
+		//  When PerformancePrecisionTradeoffs selects TableLookup, the per-timestep (surface only) calls
+		//  interpolate Tdirect and Tscattered from ScreenBmTransTable instead of calling CalcScreenBmTransComponents.
+		//  Calls with Phi and Theta (hemispherical integration) always use the exact calculation.
+
 		// REFERENCES:
 		// na
 
@@ -1315,9 +1583,6 @@ namespace DataHeatBalance {
 		// "before" the surface # is known. Theta and Phi can be passed without ScreenNumber, but DO NOT pass ScreenNumber
 		// without Theta and Phi.
 
-		// FUNCTION PARAMETER DEFINITIONS:
-		Real64 const Small( 1.E-9 ); // Small Number used to approximate zero
-
 		// FUNCTION PARAMETER DEFINITIONS:
 		int ScNum; // Index to screen data
 		Real64 Tdirect; // Beam solar transmitted through screen (dependent on sun angle)
@@ -1329,29 +1594,10 @@ namespace DataHeatBalance {
 		Real64 SurfaceTilt; // Surface tilt angle from vertical (rad)
 		Real64 SunAzimuthToScreenNormal; // Relative solar azimuth (sun angle from screen normal, 0 to PiOvr2, rad)
 		Real64 SunAltitudeToScreenNormal; // Relative solar altitude (sun angle from screen normal, -PiOvr2 to PiOvr2, rad)
-		Real64 Beta; // Compliment of relative solar azimuth (rad)
-		Real64 TransXDir; // Horizontal component of direct beam transmittance
-		Real64 TransYDir; // Vertical component of direct beam transmittance
-		Real64 Delta; // Intermediate variable used for Tscatter calculation (deg)
-		Real64 DeltaMax; // Intermediate variable used for Tscatter calculation (deg)
-		Real64 Tscattermax; // Maximum solar beam  scattered transmittance
-		Real64 TscattermaxVis; // Maximum visible beam scattered transmittance
-		Real64 ExponentInterior; // Exponent used in scattered transmittance calculation
-		// when Delta < DeltaMax (0,0 to peak)
-		Real64 ExponentExterior; // Exponent used in scattered transmittance calculation
-		// when Delta > DeltaMax (peak to max)
-		Real64 AlphaDblPrime; // Intermediate variables (used in Eng. Doc.)
-		Real64 COSMu;
-		Real64 Epsilon;
-		Real64 Eta;
-		Real64 MuPrime;
-		Real64 Gamma;
 		Real64 NormalAltitude; // Actual altitude angle of sun wrt surface outward normal (rad)
 		Real64 NormalAzimuth; // Actual azimuth angle of sun wrt surface outward normal (rad)
 		Real64 IncidentAngle; // Solar angle wrt surface outward normal to determine
 		// if sun is in front of screen (rad)
-		Real64 PeakToPlateauRatio; // Ratio of peak scattering to plateau at 0,0 incident angle
-		Real64 PeakToPlateauRatioVis; // Ratio of peak visible scattering to plateau at 0,0 incident angle
 		Real64 ReflectCyl; // Screen material reflectance
 		Real64 ReflectCylVis; // Screen material visible reflectance
 
@@ -1420,92 +1666,16 @@ namespace DataHeatBalance {
 			IncidentAngle = 0.0;
 		}
 
-		// ratio of screen material diameter to screen material spacing
-		Gamma = SurfaceScreens( ScNum ).ScreenDiameterToSpacingRatio;
-
-		// ************************************************************************************************
-		// * calculate transmittance of totally absorbing screen material (beam passing through open area)*
-		// ************************************************************************************************
-
-		// calculate compliment of relative solar azimuth
-		Beta = PiOvr2 - SunAzimuthToScreenNormal;
-
-		// Catch all divide by zero instances
-		if ( Beta > Small ) {
-			if ( std::abs( SunAltitudeToScreenNormal - PiOvr2 ) > Small ) {
-				AlphaDblPrime = std::atan( std::tan( SunAltitudeToScreenNormal ) / std::cos( SunAzimuthToScreenNormal ) );
-				TransYDir = 1.0 - Gamma * ( std::cos( AlphaDblPrime ) + std::sin( AlphaDblPrime ) * std::tan( SunAltitudeToScreenNormal ) * std::sqrt( 1.0 + pow_2( 1.0 / std::tan( Beta ) ) ) );
-				TransYDir = max( 0.0, TransYDir );
-			} else {
-				TransYDir = 0.0;
-			}
-		} else {
-			TransYDir = 0.0;
-		}
-
-		COSMu = std::sqrt( pow_2( std::cos( SunAltitudeToScreenNormal ) ) * pow_2( std::cos( SunAzimuthToScreenNormal ) ) + pow_2( std::sin( SunAltitudeToScreenNormal ) ) );
-		if ( COSMu > Small ) {
-			Epsilon = std::acos( std::cos( SunAltitudeToScreenNormal ) * std::cos( SunAzimuthToScreenNormal ) / COSMu );
-			Eta = PiOvr2 - Epsilon;
-			if ( std::cos( Epsilon ) != 0.0 ) {
-				MuPrime = std::atan( std::tan( std::acos( COSMu ) ) / std::cos( Epsilon ) );
-				if ( Eta != 0.0 ) {
-					TransXDir = 1.0 - Gamma * ( std::cos( MuPrime ) + std::sin( MuPrime ) * std::tan( std::acos( COSMu ) ) * std::sqrt( 1.0 + pow_2( 1.0 / std::tan( Eta ) ) ) );
-					TransXDir = max( 0.0, TransXDir );
-				} else {
-					TransXDir = 0.0;
-				}
-			} else {
-				TransXDir = 0.0;
-			}
+		if ( ScreenTransMethod == ScreenTransMethodTableLookup && ! present( Theta ) && ! present( Phi ) && SunAzimuthToScreenNormal <= PiOvr2 && SunAltitudeToScreenNormal <= PiOvr2 ) {
+			if ( ! ScreenBmTransTablePtr.allocated() ) InitScreenBmTransTables();
+			InterpScreenBmTransTable( ScreenBmTransTablePtr( ScNum ), SunAzimuthToScreenNormal, SunAltitudeToScreenNormal, Tdirect, Tscattered, TscatteredVis );
 		} else {
-			TransXDir = 1.0 - Gamma;
+			CalcScreenBmTransComponents( ScNum, SunAzimuthToScreenNormal, SunAltitudeToScreenNormal, Tdirect, Tscattered, TscatteredVis );
 		}
-		Tdirect = max( 0.0, TransXDir * TransYDir );
-
-		// *******************************************************************************
-		// * calculate transmittance of scattered beam due to reflecting screen material *
-		// *******************************************************************************
 
 		ReflectCyl = SurfaceScreens( ScNum ).ReflectCylinder;
 		ReflectCylVis = SurfaceScreens( ScNum ).ReflectCylinderVis;
 
-		if ( std::abs( SunAzimuthToScreenNormal - PiOvr2 ) < Small || std::abs( SunAltitudeToScreenNormal - PiOvr2 ) < Small ) {
-			Tscattered = 0.0;
-			TscatteredVis = 0.0;
-		} else {
-			//   DeltaMax and Delta are in degrees
-			DeltaMax = 89.7 - ( 10.0 * Gamma / 0.16 );
-			Delta = std::sqrt( pow_2( SunAzimuthToScreenNormal / DegToRadians ) + pow_2( SunAltitudeToScreenNormal / DegToRadians ) );
-
-			//   Use empirical model to determine maximum (peak) scattering
-			Tscattermax = 0.0229 * Gamma + 0.2971 * ReflectCyl - 0.03624 * pow_2( Gamma ) + 0.04763 * pow_2( ReflectCyl ) - 0.44416 * Gamma * ReflectCyl;
-			TscattermaxVis = 0.0229 * Gamma + 0.2971 * ReflectCylVis - 0.03624 * pow_2( Gamma ) + 0.04763 * pow_2( ReflectCylVis ) - 0.44416 * Gamma * ReflectCylVis;
-
-			//   Vary slope of interior and exterior surface of scattering model
-			ExponentInterior = -pow_2( Delta - DeltaMax ) / 600.0;
-			ExponentExterior = -std::pow( std::abs( Delta - DeltaMax ), 2.5 ) / 600.0;
-
-			//   Determine ratio of scattering at 0,0 incident angle to maximum (peak) scattering
-			PeakToPlateauRatio = 1.0 / ( 0.2 * ( 1 - Gamma ) * ReflectCyl );
-			PeakToPlateauRatioVis = 1.0 / ( 0.2 * ( 1 - Gamma ) * ReflectCylVis );
-
-			if ( Delta > DeltaMax ) {
-				//     Apply offset for plateau and use exterior exponential function to simulate actual scattering as a function of solar angles
-				Tscattered = 0.2 * ( 1.0 - Gamma ) * ReflectCyl * Tscattermax * ( 1.0 + ( PeakToPlateauRatio - 1.0 ) * std::exp( ExponentExterior ) );
-				TscatteredVis = 0.2 * ( 1.0 - Gamma ) * ReflectCylVis * TscattermaxVis * ( 1.0 + ( PeakToPlateauRatioVis - 1.0 ) * std::exp( ExponentExterior ) );
-				//     Trim off offset if solar angle (delta) is greater than maximum (peak) scattering angle
-				Tscattered -= ( 0.2 * ( 1.0 - Gamma ) * ReflectCyl * Tscattermax ) * max( 0.0, ( Delta - DeltaMax ) / ( 90.0 - DeltaMax ) );
-				TscatteredVis -= ( 0.2 * ( 1.0 - Gamma ) * ReflectCylVis * TscattermaxVis ) * max( 0.0, ( Delta - DeltaMax ) / ( 90.0 - DeltaMax ) );
-			} else {
-				//     Apply offset for plateau and use interior exponential function to simulate actual scattering as a function of solar angles
-				Tscattered = 0.2 * ( 1.0 - Gamma ) * ReflectCyl * Tscattermax * ( 1.0 + ( PeakToPlateauRatio - 1.0 ) * std::exp( ExponentInterior ) );
-				TscatteredVis = 0.2 * ( 1.0 - Gamma ) * ReflectCylVis * TscattermaxVis * ( 1.0 + ( PeakToPlateauRatioVis - 1.0 ) * std::exp( ExponentInterior ) );
-			}
-		}
-		Tscattered = max( 0.0, Tscattered );
-		TscatteredVis = max( 0.0, TscatteredVis );
-
 		if ( SurfaceScreens( ScNum ).ScreenBeamReflectanceAccounting == DoNotModel ) {
 			if ( std::abs( IncidentAngle ) <= PiOvr2 ) {
 				SurfaceScreens( ScNum ).BmBmTrans = Tdirect;
@@ -1566,6 +1736,132 @@ namespace DataHeatBalance {
 
 	}
 
+	void
+	InitScreenBmTransTables()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//  Build the direct and scattered beam transmittance tables used by CalcScreenTransmittance
+		//  when ScreenTransMethod is TableLookup.
+
+		// METHODOLOGY EMPLOYED:
+		//  The angle dependent terms only depend on the screen material, so one table is built for each
+		//  Material:WindowScreen in use and shared by all windows with that screen.  Nodes are spaced
+		//  PiOvr2/(NumScreenTableAngles-1) apart in relative azimuth and relative altitude and filled by
+		//  CalcScreenBmTransComponents.
+
+		// Using/Aliasing
+		using DataGlobals::PiOvr2;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ScNum; // Index to screen data
+		int TableNum; // Index into ScreenBmTransTable
+		int NumTables; // Number of distinct screen materials
+		int iAz; // Relative azimuth node
+		int iAlt; // Relative altitude node
+		Real64 AngleStep; // Node spacing (rad)
+
+		ScreenBmTransTablePtr.dimension( NumSurfaceScreens, 0 );
+		ScreenBmTransTable.allocate( NumSurfaceScreens );
+		AngleStep = PiOvr2 / double( NumScreenTableAngles - 1 );
+
+		NumTables = 0;
+		for ( ScNum = 1; ScNum <= NumSurfaceScreens; ++ScNum ) {
+			for ( TableNum = 1; TableNum <= NumTables; ++TableNum ) {
+				if ( ScreenBmTransTable( TableNum ).MaterialNumber == SurfaceScreens( ScNum ).MaterialNumber ) break;
+			}
+			if ( TableNum <= NumTables ) {
+				ScreenBmTransTablePtr( ScNum ) = TableNum;
+				continue;
+			}
+			++NumTables;
+			ScreenBmTransTablePtr( ScNum ) = NumTables;
+			auto & Table( ScreenBmTransTable( NumTables ) );
+			Table.MaterialNumber = SurfaceScreens( ScNum ).MaterialNumber;
+			Table.Tdirect.dimension( NumScreenTableAngles, NumScreenTableAngles, 0.0 );
+			Table.Tscattered.dimension( NumScreenTableAngles, NumScreenTableAngles, 0.0 );
+			Table.TscatteredVis.dimension( NumScreenTableAngles, NumScreenTableAngles, 0.0 );
+			for ( iAz = 1; iAz <= NumScreenTableAngles; ++iAz ) {
+				for ( iAlt = 1; iAlt <= NumScreenTableAngles; ++iAlt ) {
+					CalcScreenBmTransComponents( ScNum, ( iAz - 1 ) * AngleStep, ( iAlt - 1 ) * AngleStep, Table.Tdirect( iAz, iAlt ), Table.Tscattered( iAz, iAlt ), Table.TscatteredVis( iAz, iAlt ) );
+				}
+			}
+		}
+		ScreenBmTransTable.redimension( NumTables );
+
+	}
+
+	void
+	InterpScreenBmTransTable(
+		int const TableNum, // Index into ScreenBmTransTable
+		Real64 const SunAzimuthToScreenNormal, // Relative solar azimuth, 0 to PiOvr2 (rad)
+		Real64 const SunAltitudeToScreenNormal, // Relative solar altitude, 0 to PiOvr2 (rad)
+		Real64 & Tdirect, // Beam solar transmitted through screen
+		Real64 & Tscattered, // Beam solar reflected through screen
+		Real64 & TscatteredVis // Visible beam solar reflected through screen
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//  Bilinear interpolation of a screen beam transmittance table.
+
+		// METHODOLOGY EMPLOYED:
+		//  Error against CalcScreenBmTransComponents at 0.5 deg node spacing (screens with diameter to spacing
+		//  ratio 0.05-0.16 and reflectance 0.1-0.5, sampled off-node over the whole quadrant):
+		//   Tdirect: mean absolute error < 2.E-4, 99th percentile < 0.003.  The maximum (up to about 0.03)
+		//   occurs in the few cells crossed by the contour where the direct transmittance is clipped to zero.
+		//   Tscattered: < 0.001 except in the last cell before 90 deg relative azimuth or altitude, where the
+		//   exact model drops scattering to zero and the table ramps down linearly instead.
+
+		// Using/Aliasing
+		using DataGlobals::PiOvr2;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 xAz; // Relative azimuth in node units
+		Real64 xAlt; // Relative altitude in node units
+		int iAz; // Lower azimuth node
+		int iAlt; // Lower altitude node
+		Real64 fAz; // Interpolation fraction in azimuth
+		Real64 fAlt; // Interpolation fraction in altitude
+		Real64 w11; // Bilinear weights
+		Real64 w21;
+		Real64 w12;
+		Real64 w22;
+
+		auto const & Table( ScreenBmTransTable( TableNum ) );
+
+		xAz = max( 0.0, min( SunAzimuthToScreenNormal, PiOvr2 ) ) / PiOvr2 * double( NumScreenTableAngles - 1 );
+		xAlt = max( 0.0, min( SunAltitudeToScreenNormal, PiOvr2 ) ) / PiOvr2 * double( NumScreenTableAngles - 1 );
+		iAz = min( int( xAz ), NumScreenTableAngles - 2 );
+		iAlt = min( int( xAlt ), NumScreenTableAngles - 2 );
+		fAz = xAz - iAz;
+		fAlt = xAlt - iAlt;
+		++iAz; // 1-based node index
+		++iAlt;
+
+		w11 = ( 1.0 - fAz ) * ( 1.0 - fAlt );
+		w21 = fAz * ( 1.0 - fAlt );
+		w12 = ( 1.0 - fAz ) * fAlt;
+		w22 = fAz * fAlt;
+
+		Tdirect = w11 * Table.Tdirect( iAz, iAlt ) + w21 * Table.Tdirect( iAz + 1, iAlt ) + w12 * Table.Tdirect( iAz, iAlt + 1 ) + w22 * Table.Tdirect( iAz + 1, iAlt + 1 );
+		Tscattered = w11 * Table.Tscattered( iAz, iAlt ) + w21 * Table.Tscattered( iAz + 1, iAlt ) + w12 * Table.Tscattered( iAz, iAlt + 1 ) + w22 * Table.Tscattered( iAz + 1, iAlt + 1 );
+		TscatteredVis = w11 * Table.TscatteredVis( iAz, iAlt ) + w21 * Table.TscatteredVis( iAz + 1, iAlt ) + w12 * Table.TscatteredVis( iAz, iAlt + 1 ) + w22 * Table.TscatteredVis( iAz + 1, iAlt + 1 );
+
+	}
+
 	std::string
 	DisplayMaterialRoughness( int const Roughness ) // Roughness String
 	{
@@ -1,6 +1,10 @@
 #ifndef DataHeatBalance_hh_INCLUDED
 #define DataHeatBalance_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray2D.hh>
@@ -235,6 +239,23 @@ namespace DataHeatBalance {
 	extern Real64 const HighDiffusivityThreshold; // used to check if Material properties are out of line.
 	extern Real64 const ThinMaterialLayerThreshold; // 3 mm lower limit to expected material layers
 
+	// Parameters for ScreenTransMethod (PerformancePrecisionTradeoffs)
+	extern int const ScreenTransMethodExact;
+	extern int const ScreenTransMethodTableLookup;
+
+	// Parameters for InsideSurfTempPredictor (PerformancePrecisionTradeoffs)
+	extern int const InsideSurfTempPredictorNone;
+	extern int const InsideSurfTempPredictorLinear;
+	extern int const InsideSurfTempPredictorQuadratic;
+
+	// Parameters for SurfaceCaptureMode (Output:SurfaceHeatBalanceCapture)
+	extern int const SurfaceCaptureNone;
+	extern int const SurfaceCaptureWrite;
+	extern int const SurfaceCaptureReplay;
+
+	// Window screen beam property tables
+	extern int const NumScreenTableAngles; // Table nodes over 0-90 deg of relative azimuth and altitude (0.5 deg spacing)
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// thermochromic windows
@@ -342,6 +363,26 @@ namespace DataHeatBalance {
 	extern int TotScreens; // Total number of exterior window screen materials
 	extern int TotTCGlazings; // Number of TC glazing object - WindowMaterial:Glazing:Thermochromic found in the idf file
 	extern int NumSurfaceScreens; // Total number of screens on exterior windows
+	extern int ScreenTransMethod; // ScreenTransMethodExact or ScreenTransMethodTableLookup
+	extern int InsideSurfTempPredictor; // InsideSurfTempPredictorNone, ...Linear or ...Quadratic
+	extern int SurfaceCaptureMode; // SurfaceCaptureNone, ...Write or ...Replay
+	extern std::string SurfaceCaptureFileName; // Capture file of Output:SurfaceHeatBalanceCapture
+	extern int SurfaceCaptureDay; // Day of simulation of the captured zone timestep
+	extern int SurfaceCaptureHour; // Hour of day of the captured zone timestep
+	extern int SurfaceCaptureTimeStep; // Zone timestep within the hour of the captured zone timestep
+	extern int SurfaceCaptureRepetitions; // Surface heat balance repetitions of a replay
+	extern std::string HeatBalanceScalingFileName; // CSV file of Output:HeatBalanceScaling (blank = none)
+	extern std::string HeatBalanceScalingCase; // Case label of the rows this run adds to it
+	extern bool TimeDecompositionUsed; // True if HeatBalance:TimeDecomposition is in the input
+	extern std::string CheckpointFilePrefix; // Prefix of the chunk boundary checkpoints of this run
+	extern std::string CheckpointReferencePrefix; // Prefix of the checkpoints of a serial reference run
+	extern int ChunkLength; // Days between chunk boundaries
+	extern int ChunkNumber; // Chunk simulated by this run (0 = the whole run period, serially)
+	extern int ChunkOverlapDays; // Days simulated before the start of the chunk
+	extern int TotParametricVariants; // Number of HeatBalance:ParametricVariant objects
+	extern int MaxConcurrentVariants; // Variants run at the same time (0 = number of processors)
+	extern int ParametricVariantNum; // Variant simulated by this process (0 = the base case)
+	extern FArray1D_int ScreenBmTransTablePtr; // Index into ScreenBmTransTable for each SurfaceScreens entry
 	extern int TotShades; // Total number of shade materials
 	extern int TotComplexShades; // Total number of shading materials for complex fenestrations
 	extern int TotComplexGaps; // Total number of window gaps for complex fenestrations
@@ -472,6 +513,10 @@ namespace DataHeatBalance {
 	extern FArray1D< Real64 > NominalRforNominalUCalculation; // Nominal R values are summed to calculate NominalU values for constructions
 	extern FArray1D< Real64 > NominalU; // Nominal U value for each construction -- used in matching interzone surfaces
 
+	// Reverse construction lookup (interzone surfaces)
+	extern std::unordered_map< std::string, int > ConstructLayerSignatureMap; // layer signature -> first construction with those layers
+	extern int NumConstructsInLayerSignatureMap; // Constructions 1..this value have been entered into ConstructLayerSignatureMap
+
 	// removed variables (these were all arrays):
 	//REAL(r64), ALLOCATABLE, :: DifIncInsSurfIntensRep    !Diffuse sol irradiance from ext wins on inside of surface (W/m2)
 	//REAL(r64), ALLOCATABLE, :: DifIncInsSurfAmountRep    !Diffuse sol amount from ext wins on inside of surface (W)
@@ -4121,6 +4166,73 @@ namespace DataHeatBalance {
 
 	};
 
+	struct ScreenBmTransTableData
+	{
+		// Members
+		int MaterialNumber; // Material pointer for the screen this table was built from
+		FArray2D< Real64 > Tdirect; // Beam transmittance through the open area, (relative azimuth, relative altitude)
+		FArray2D< Real64 > Tscattered; // Solar beam transmitted by reflection off the screen material
+		FArray2D< Real64 > TscatteredVis; // Visible beam transmitted by reflection off the screen material
+
+		// Default Constructor
+		ScreenBmTransTableData() :
+			MaterialNumber( 0 )
+		{}
+
+		// Member Constructor
+		ScreenBmTransTableData(
+			int const MaterialNumber, // Material pointer for the screen this table was built from
+			FArray2< Real64 > const & Tdirect, // Beam transmittance through the open area, (relative azimuth, relative altitude)
+			FArray2< Real64 > const & Tscattered, // Solar beam transmitted by reflection off the screen material
+			FArray2< Real64 > const & TscatteredVis // Visible beam transmitted by reflection off the screen material
+		) :
+			MaterialNumber( MaterialNumber ),
+			Tdirect( Tdirect ),
+			Tscattered( Tscattered ),
+			TscatteredVis( TscatteredVis )
+		{}
+
+	};
+
+	struct ParametricVariantData
+	{
+		// Members
+		std::string Name; // Name of the variant, also the directory of its output files
+		int NumOverrides; // Number of material overrides
+		FArray1D_string MaterialName; // Material changed by each override
+		FArray1D_string FieldName; // IDD field name of the property changed by each override
+		FArray1D< Real64 > Value; // New value of the property for each override
+		int ProcessID; // Process running the variant (0 = not started)
+		int ExitStatus; // Exit status of that process (-1 = did not finish)
+
+		// Default Constructor
+		ParametricVariantData() :
+			NumOverrides( 0 ),
+			ProcessID( 0 ),
+			ExitStatus( -1 )
+		{}
+
+		// Member Constructor
+		ParametricVariantData(
+			std::string const & Name, // Name of the variant, also the directory of its output files
+			int const NumOverrides, // Number of material overrides
+			FArray1_string const & MaterialName, // Material changed by each override
+			FArray1_string const & FieldName, // IDD field name of the property changed by each override
+			FArray1< Real64 > const & Value, // New value of the property for each override
+			int const ProcessID, // Process running the variant (0 = not started)
+			int const ExitStatus // Exit status of that process (-1 = did not finish)
+		) :
+			Name( Name ),
+			NumOverrides( NumOverrides ),
+			MaterialName( MaterialName ),
+			FieldName( FieldName ),
+			Value( Value ),
+			ProcessID( ProcessID ),
+			ExitStatus( ExitStatus )
+		{}
+
+	};
+
 	struct ZoneCatEUseData
 	{
 		// Members
@@ -5312,6 +5424,8 @@ namespace DataHeatBalance {
 	extern FArray1D< WindowThermalModelParams > WindowThermalModel;
 	extern FArray1D< SurfaceScreenProperties > SurfaceScreens;
 	extern FArray1D< ScreenTransData > ScreenTrans;
+	extern FArray1D< ScreenBmTransTableData > ScreenBmTransTable;
+	extern FArray1D< ParametricVariantData > ParametricVariant;
 	extern FArray1D< ZoneCatEUseData > ZoneIntEEuse;
 	extern FArray1D< RefrigCaseCreditData > RefrigCaseCredit;
 	extern FArray1D< HeatReclaimRefrigeratedRackData > HeatReclaimRefrigeratedRack;
@@ -5347,6 +5461,15 @@ namespace DataHeatBalance {
 		bool & ErrorsFound
 	);
 
+	std::string
+	ConstructionLayerSignature( FArray1_int const & LayerPoint ); // Layer pointers of a construction
+
+	void
+	ReserveConstructionStorage( int const NumConstructsNeeded ); // Number of constructions that must fit
+
+	void
+	TrimConstructionStorage();
+
 	void
 	AddVariableSlatBlind(
 		int const inBlindNumber, // current Blind Number/pointer to name
@@ -5362,6 +5485,29 @@ namespace DataHeatBalance {
 		Optional_int_const ScreenNumber = _ // Optional screen number
 	);
 
+	void
+	CalcScreenBmTransComponents(
+		int const ScNum, // Index to screen data
+		Real64 const SunAzimuthToScreenNormal, // Relative solar azimuth (rad)
+		Real64 const SunAltitudeToScreenNormal, // Relative solar altitude (rad)
+		Real64 & Tdirect, // Beam solar transmitted through screen
+		Real64 & Tscattered, // Beam solar reflected through screen
+		Real64 & TscatteredVis // Visible beam solar reflected through screen
+	);
+
+	void
+	InitScreenBmTransTables();
+
+	void
+	InterpScreenBmTransTable(
+		int const TableNum, // Index into ScreenBmTransTable
+		Real64 const SunAzimuthToScreenNormal, // Relative solar azimuth, 0 to PiOvr2 (rad)
+		Real64 const SunAltitudeToScreenNormal, // Relative solar altitude, 0 to PiOvr2 (rad)
+		Real64 & Tdirect, // Beam solar transmitted through screen
+		Real64 & Tscattered, // Beam solar reflected through screen
+		Real64 & TscatteredVis // Visible beam solar reflected through screen
+	);
+
 	std::string
 	DisplayMaterialRoughness( int const Roughness ); // Roughness String
 
@@ -18,6 +18,7 @@
 #include <DataSurfaces.hh>
 #include <DataWater.hh>
 #include <General.hh>
+#include <HeatBalanceSurfaceManager.hh>
 #include <OutputProcessor.hh>
 #include <Psychrometrics.hh>
 #include <UtilityRoutines.hh>
@@ -81,6 +82,20 @@ namespace EcoRoofManager {
 
 	Real64 Tfold; // leaf temperature from the previous time step
 	Real64 Tgold; // ground temperature from the previous time step
+	// State carried from one timestep to the next, at module level so that heat balance checkpoints can
+	// save and restore it.  CalcEcoRoof and GreenRoof_with_PlantCoverage each keep their own.
+	Real64 Moisture( 0.0 ); // Near-surface soil moisture content of CalcEcoRoof (m^3/m^3)
+	Real64 MeanRootMoisture( 0.0 ); // Root zone soil moisture content of CalcEcoRoof (m^3/m^3)
+	Real64 Vfluxf( 0.0 ); // Water evapotr. rate associated with latent heat from vegetation of CalcEcoRoof [m/s]
+	Real64 Vfluxg( 0.0 ); // Water evapotr. rate associated with latent heat from ground surface of CalcEcoRoof [m/s]
+	Real64 PlantCoverMoisture( 0.0 ); // Near-surface soil moisture content of GreenRoof_with_PlantCoverage (m^3/m^3)
+	Real64 PlantCoverMeanRootMoisture( 0.0 ); // Root zone soil moisture content of GreenRoof_with_PlantCoverage (m^3/m^3)
+	Real64 PlantCoverVfluxf( 0.0 ); // Vegetation evapotr. rate of GreenRoof_with_PlantCoverage [m/s]
+	Real64 PlantCoverVfluxg( 0.0 ); // Ground surface evapotr. rate of GreenRoof_with_PlantCoverage [m/s]
+	Real64 T_plant( 0.0 ); // Plant (leaf) temperature of GreenRoof_with_PlantCoverage (K)
+	Real64 T_soil( 0.0 ); // Soil surface temperature under the plants of GreenRoof_with_PlantCoverage (K)
+	Real64 T_bare_soil( 0.0 ); // Bare soil surface temperature of GreenRoof_with_PlantCoverage (K)
+	Real64 Tsoil_avg( 0.0 ); // Average soil temperature of GreenRoof_with_PlantCoverage (K)
 	bool EcoRoofbeginFlag( true );
 	
 	// MODULE SUBROUTINES:
@@ -132,6 +147,8 @@ namespace EcoRoofManager {
 		using ConvectionCoefficients::InitExteriorConvectionCoeff;
 		using ConvectionCoefficients::SetExtConvectionCoeff;
 		using ConvectionCoefficients::SetIntConvectionCoeff;
+		using HeatBalanceSurfaceManager::CTFOutFaceCondConst;
+		using HeatBalanceSurfaceManager::CTFOutFaceCondCoef;
 		
 		// Locals
 		//SUBROUTINE ARGUMENT DEFINITIONS:
@@ -152,12 +169,8 @@ namespace EcoRoofManager {
 		Real64 Latm;               //Long Wave Radiation (W/m^2)
         Real64 Q_sol_abs_plants;  //Absorbed SW radiation by the plants
         Real64 Mg;               //Surface soil moisture content m^3/m^3 (Moisture / MoistureMax)
-        static Real64 T_plant;  //Plant (leaf) temperature (K)
-        static Real64 T_soil;  //Soil surface temperature (K)
-        static Real64 T_bare_soil;    //Bare soil surface temperature (K)
 		
 	//***--------
-		static Real64 Tsoil_avg;  //Average soil temperature [K]
 		
 		static Real64 Tsoil_avg_Rep;
 		static Real64 T_plant_Rep;
@@ -202,10 +215,8 @@ namespace EcoRoofManager {
 		static Real64 Alphap;  //Plant albedo
 		static Real64 epsilong;  //Ground emisivity
 		static Real64 epsilonp;  // Plant emisivity
-		static Real64 Moisture;  // m^3/m^3.The moisture content in the soil is the value provided by a user
 		static Real64 MoistureResidual;  // m^3/m^3. Residual & maximum water contents are unique to each material.
 		static Real64 MoistureMax;           // Maximum volumetric moisture content (porosity) m^3/m^3
-		static Real64 MeanRootMoisture;      // Mean value of root moisture m^3/m^3
 		static Real64 SoilThickness;         // Soil thickness (m)
 		static Real64 StomatalResistanceMin;  // s/m . ! Minimum stomatal resistance is unique for each veg. type.
 		static Real64 sigma_f;    //Plant coverage
@@ -215,8 +226,6 @@ namespace EcoRoofManager {
 		Real64 tau_lw;
 		Real64 EpsilonOne;
 		Real64 RH;
-		static Real64 Vfluxf( 0.0 );  //Water evapotr. rate associated with latent heat from vegetation [m/s]
-		static Real64 Vfluxg( 0.0 );  //Water evapotr. rate associated with latent heat from ground surface [m/s]
 		static Real64 Alphag_UnUsed( 0.3 );  //Ground Albedo (From EcoRoof Model - Not used here)
 		Real64 WS;
 		Real64 Rhoa;
@@ -224,7 +233,6 @@ namespace EcoRoofManager {
 		Real64 r_s_sub;
 		Real64 Q_sol_abs_soil;
 		Real64 Q_sol_abs_bare_soil;
-		Real64 F1temp;
 		Real64 Qsoilpart1;
 		Real64 Qsoilpart2;
 		Real64 Tp_new;
@@ -329,8 +337,8 @@ namespace EcoRoofManager {
             epsilong = Material(Construct(ConstrNum).LayerPoint( 1 )).AbsorpThermal;   // Soil Emisivity
             MoistureMax = Material(Construct(ConstrNum).LayerPoint( 1 )).Porosity;   // Max moisture content in soil
             MoistureResidual = Material(Construct(ConstrNum).LayerPoint( 1 )).MinMoisture;   // Min moisture content in soil
-            Moisture = Material(Construct(ConstrNum).LayerPoint( 1 )).InitMoisture;   // Initial moisture content in soil
-            MeanRootMoisture = Moisture; // DJS Oct 2007 Release --> all soil at same initial moisture for Reverse DD fix
+            PlantCoverMoisture = Material(Construct(ConstrNum).LayerPoint( 1 )).InitMoisture;   // Initial moisture content in soil
+            PlantCoverMeanRootMoisture = PlantCoverMoisture; // DJS Oct 2007 Release --> all soil at same initial moisture for Reverse DD fix
             SoilThickness = Material(Construct(ConstrNum).LayerPoint( 1 )).Thickness; // Total thickness of soil layer (m)
 
             sigma_f = Material(Construct(ConstrNum).LayerPoint( 1 )).PlantCoverage;
@@ -346,12 +354,12 @@ namespace EcoRoofManager {
 
             SetupOutputVariable( "Green Roof Soil Temperature [C]", Tsoil_avg_Rep, "Zone", "State", "Environment" );
             SetupOutputVariable( "Green Roof Vegetation Temperature [C]", T_plant_Rep, "Zone", "State", "Environment" );
-            SetupOutputVariable( "Green Roof Soil Root Moisture Ratio []", MeanRootMoisture, "Zone", "State", "Environment" );
-            SetupOutputVariable( "Green Roof Soil Near Surface Moisture Ratio []", Moisture, "Zone", "State", "Environment" );
+            SetupOutputVariable( "Green Roof Soil Root Moisture Ratio []", PlantCoverMeanRootMoisture, "Zone", "State", "Environment" );
+            SetupOutputVariable( "Green Roof Soil Near Surface Moisture Ratio []", PlantCoverMoisture, "Zone", "State", "Environment" );
             SetupOutputVariable( "Green Roof Soil Sensible Heat Transfer Rate per Area [W/m2]", Qconv_s_avg_Rep, "Zone", "State", "Environment" );
             SetupOutputVariable( "Green Roof Vegetation Sensible Heat Transfer Rate per Area [W/m2]", Qconv_p_Rep, "Zone", "State", "Environment" );
-            SetupOutputVariable( "Green Roof Vegetation Moisture Transfer Rate [m/s]", Vfluxf, "Zone", "State", "Environment" );
-            SetupOutputVariable( "Green Roof Soil Moisture Transfer Rate [m/s]", Vfluxg, "Zone", "State", "Environment" );
+            SetupOutputVariable( "Green Roof Vegetation Moisture Transfer Rate [m/s]", PlantCoverVfluxf, "Zone", "State", "Environment" );
+            SetupOutputVariable( "Green Roof Soil Moisture Transfer Rate [m/s]", PlantCoverVfluxg, "Zone", "State", "Environment" );
             SetupOutputVariable( "Green Roof Vegetation Latent Heat Transfer Rate per Area [W/m2]", Q_ET_p_Rep, "Zone", "State", "Environment" );
             SetupOutputVariable( "Green Roof Soil Latent Heat Transfer Rate per Area [W/m2]", Q_E_avg_Rep, "Zone", "State","Environment" );
 
@@ -380,8 +388,8 @@ namespace EcoRoofManager {
 // Make sure the ecoroof module resets its conditions at start of EVERY warmup day and every new design day
 // for Reverse DD testing
         if (BeginEnvrnFlag || WarmupFlag) {
-            Moisture = Material(Construct(ConstrNum).LayerPoint( 1 )).InitMoisture;   // Initial moisture content in soil
-            MeanRootMoisture = Moisture;  // Start the root zone moisture at the same value as the surface.
+            PlantCoverMoisture = Material(Construct(ConstrNum).LayerPoint( 1 )).InitMoisture;   // Initial moisture content in soil
+            PlantCoverMeanRootMoisture = PlantCoverMoisture;  // Start the root zone moisture at the same value as the surface.
             Alphag = 1.0 - Material(Construct(ConstrNum).LayerPoint( 1 )).AbsorpSolar; // albedo rather than absorptivity
         } 
 // DJS July 2007			
@@ -390,8 +398,8 @@ namespace EcoRoofManager {
             T_soil = OutDryBulbTempAt(Surface(SurfNum).Centroid.z) + KelvinConv;        //OutDrybulbTemp           // initial guess
             T_plant = OutDryBulbTempAt(Surface(SurfNum).Centroid.z) + KelvinConv;        //OutDrybulbTemp           // initial guess
             T_bare_soil = OutDryBulbTempAt(Surface(SurfNum).Centroid.z) + KelvinConv;   //OutDrybulbTemp           // initial guess
-            Vfluxf = 0.0;
-            Vfluxg = 0.0;
+            PlantCoverVfluxf = 0.0;
+            PlantCoverVfluxg = 0.0;
             CumRunoff = 0.0;
             CumET = 0.0;
             CumPrecip = 0.0;
@@ -422,10 +430,10 @@ namespace EcoRoofManager {
 
         if (SurfNum == FirstEcoSurf) {
 //----NOTE: unit, T_soil, T_plant, Qsoil are unused in 'UpdateSoilProps' subroutine.
-           UpdateSoilProps( Moisture, MeanRootMoisture, MoistureMax, MoistureResidual, SoilThickness, Vfluxf, Vfluxg, ConstrNum, Alphag_UnUsed, unit, T_soil, T_plant, Qsoil );
+           UpdateSoilProps( PlantCoverMoisture, PlantCoverMeanRootMoisture, MoistureMax, MoistureResidual, SoilThickness, PlantCoverVfluxf, PlantCoverVfluxg, ConstrNum, Alphag_UnUsed, unit, T_soil, T_plant, Qsoil );
 
 //---Soil albedo
-           Mg = Moisture / MoistureMax;
+           Mg = PlantCoverMoisture / MoistureMax;
            Alphag = 0.2171 * pow_2(Mg) - 0.4336 * Mg + 0.3143;
     
            WS = WindSpeedAt(Surface(SurfNum).Centroid.z);         // Windspeed at Z of roof
@@ -449,13 +457,13 @@ namespace EcoRoofManager {
            f_solar = 1 + std::exp( -0.034 * ( RS - 3.5));
     
 //---f_VWC
-           if ( Moisture > 0.7*VWC_fc ) {
+           if ( PlantCoverMoisture > 0.7*VWC_fc ) {
                f_VWC = 1;
 		   } 	   
            else {
-               f_VWC = max(0.0,1/((Moisture - VWC_wp)/(0.7*VWC_fc - VWC_wp))); }
+               f_VWC = max(0.0,1/((PlantCoverMoisture - VWC_wp)/(0.7*VWC_fc - VWC_wp))); }
         }
-        if (Moisture < VWC_wp) {
+        if (PlantCoverMoisture < VWC_wp) {
             f_VWC = 1000;
         } 
     
@@ -466,16 +474,9 @@ namespace EcoRoofManager {
         NU_por = 1.128 * std::sqrt(Pe);               //Nusselt number for porous media
         h_por = NU_por*k_por/length;
 		
-//---Conduction based on EcoRoof subroutine 
-        if ( Construct( ConstrNum ).CTFCross( 0 ) > 0.01) {
-            F1temp = Construct( ConstrNum ).CTFCross( 0 ) / ( Construct( ConstrNum ).CTFInside( 0 ) + HConvIn( SurfNum ) );
-            Qsoilpart1 = -CTFConstOutPart( SurfNum ) + F1temp * ( CTFConstInPart( SurfNum ) + QRadSWInAbs( SurfNum ) + QRadThermInAbs( SurfNum ) + Construct( ConstrNum ).CTFSourceIn( 0 ) * QsrcHist( SurfNum,1 ) + HConvIn( SurfNum ) * MAT( ZoneNum ) + NetLWRadToSurf( SurfNum ) );
-        } 
-		else {
-			Qsoilpart1 = -CTFConstOutPart( SurfNum ) + Construct( ConstrNum ).CTFCross( 0 ) * TempSurfIn( SurfNum );
-            F1temp = 0.0;
-        }
-        Qsoilpart2 = Construct( ConstrNum ).CTFOutside( 0 ) - F1temp * Construct( ConstrNum ).CTFCross( 0 );
+//---Conduction based on EcoRoof subroutine (outside face linearization from CalcCTFOutFaceCoupling)
+        Qsoilpart1 = CTFOutFaceCondConst( SurfNum );
+        Qsoilpart2 = CTFOutFaceCondCoef( SurfNum );
 
 
 //---Newton's method for solving T_plant
@@ -753,15 +754,15 @@ namespace EcoRoofManager {
         if ((Tsoil_avg  - KelvinConv) < 0.0 ) i_fg_g = 2.838e6;  // per FASST documentation p.15 after eqn. 37.
 
      if (sigma_f == 0.0) {
-         Vfluxf = 0.0;
+         PlantCoverVfluxf = 0.0;
      }
 	 else {
-         Vfluxf= Q_ET_p / i_fg_p / 990.0;               // water evapotranspire rate [m/s]
+         PlantCoverVfluxf= Q_ET_p / i_fg_p / 990.0;               // water evapotranspire rate [m/s]
      }
      Q_E_avg = sigma_f * Q_E_s + ( 1 - sigma_f ) * Q_E_bare_s;
-     Vfluxg = Q_E_avg / i_fg_g / 990.0;               // water evapotranspire rate [m/s]
-     if (Vfluxf < 0.0) Vfluxf = 0.0;       // According to FASST Veg. Models p. 11, eqn 26-27, if Qfsat > qaf the actual
-     if (Vfluxg < 0.0) Vfluxg = 0.0;       // evaporative fluxes should be set to zero (delta_c = 1 or 0).
+     PlantCoverVfluxg = Q_E_avg / i_fg_g / 990.0;               // water evapotranspire rate [m/s]
+     if (PlantCoverVfluxf < 0.0) PlantCoverVfluxf = 0.0;       // According to FASST Veg. Models p. 11, eqn 26-27, if Qfsat > qaf the actual
+     if (PlantCoverVfluxg < 0.0) PlantCoverVfluxg = 0.0;       // evaporative fluxes should be set to zero (delta_c = 1 or 0).
 
     } 		
   
@@ -1027,6 +1028,8 @@ void
 		using ConvectionCoefficients::InitExteriorConvectionCoeff;
 		using ConvectionCoefficients::SetExtConvectionCoeff;
 		using ConvectionCoefficients::SetIntConvectionCoeff;
+		using HeatBalanceSurfaceManager::CTFOutFaceCondConst;
+		using HeatBalanceSurfaceManager::CTFOutFaceCondCoef;
 
 		// Locals
 		//SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1055,7 +1058,6 @@ void
 		//  INTEGER :: OPtr
 		//  INTEGER :: OSCScheduleIndex    ! Index number for OSC ConstTempSurfaceName
 
-		static bool QuickConductionSurf( false ); // indicator for quick conduction surface
 		static Real64 LAI( 0.2 ); // Leaf area index
 		static Real64 epsilonf( 0.95 ); // Leaf Emisivity
 		static Real64 epsilong( 0.95 ); // Soil Emisivity
@@ -1071,11 +1073,9 @@ void
 		// DJS Oct 2007 release - note I got rid of the initialization of moisture and meanrootmoisture here as these
 		// values are now set at beginning of each new DD and each new warm-up loop.
 		// DJS
-		static Real64 Moisture; // m^3/m^3.The moisture content in the soil is the value provided by a user
 		static Real64 MoistureResidual( 0.05 ); // m^3/m^3. Residual & maximum water contents are unique to each material.
 		// See Frankenstein et al (2004b) for data.
 		static Real64 MoistureMax( 0.5 ); // Maximum volumetric moisture content (porosity) m^3/m^3
-		static Real64 MeanRootMoisture; // Mean value of root moisture m^3/m^3
 		static Real64 SoilThickness( 0.2 ); // Soil thickness (m)
 		static Real64 StomatalResistanceMin; // s/m . ! Minimum stomatal resistance is unique for each veg. type.
 		static Real64 f3( 1.0 ); // As the value of gd for tall grass is 0, then f3 = 1
@@ -1092,7 +1092,6 @@ void
 
 		Real64 qg; // mixing ratio of air at surface.
 		static Real64 Lf; // latent heat flux
-		static Real64 Vfluxf( 0.0 ); // Water evapotr. rate associated with latent heat from vegetation [m/s]
 		Real64 RS; // shortwave radiation
 		static Real64 Qsoil( 0.0 ); // heat flux from the soil layer
 
@@ -1134,7 +1133,6 @@ void
 		Real64 qsg; // Saturation specific humidity(mixing ratio?) at ground surface temperature
 		Real64 Leg; // Latent heat vaporization  at the ground temperature (J/kg)
 		Real64 Desg; // derivative of esg Saturation vapor pressure(?)
-		Real64 F1temp; // intermediate variable in computing flux from the soil layer
 		Real64 P1; // intermediate variable in the equation for Tf
 		Real64 P2; // intermediate variable in the equation for Tf and Tg
 		Real64 P3; // intermediate variable in the equation for Tf and Tg
@@ -1156,7 +1154,6 @@ void
 		Real64 rn; // rn is the combined effect of both stomatal and aerodynamic resistances
 		// in fact this is called r'' in the main report
 		static Real64 Lg( 0.0 ); // latent heat flux from ground surface
-		static Real64 Vfluxg( 0.0 ); // Water evapotr. rate associated with latent heat from ground surface [m/s]
 		Real64 T1G; // intermediate variable in the equation for Tg
 		Real64 Qsoilpart1; // intermediate variable for evaluating Qsoil (part without the unknown)
 		Real64 Qsoilpart2; // intermediate variable for evaluating Qsoil (part coeff of the ground temperature)
@@ -1282,16 +1279,9 @@ void
 			Tg = Tgold;
 			Tf = Tfold;
 
-			if ( Construct( ConstrNum ).CTFCross( 0 ) > 0.01 ) {
-				QuickConductionSurf = true;
-				F1temp = Construct( ConstrNum ).CTFCross( 0 ) / ( Construct( ConstrNum ).CTFInside( 0 ) + HConvIn( SurfNum ) );
-				Qsoilpart1 = -CTFConstOutPart( SurfNum ) + F1temp * ( CTFConstInPart( SurfNum ) + QRadSWInAbs( SurfNum ) + QRadThermInAbs( SurfNum ) + Construct( ConstrNum ).CTFSourceIn( 0 ) * QsrcHist( SurfNum, 1 ) + HConvIn( SurfNum ) * MAT( ZoneNum ) + NetLWRadToSurf( SurfNum ) );
-			} else {
-				Qsoilpart1 = -CTFConstOutPart( SurfNum ) + Construct( ConstrNum ).CTFCross( 0 ) * TempSurfIn( SurfNum );
-				F1temp = 0.0;
-			}
-
-			Qsoilpart2 = Construct( ConstrNum ).CTFOutside( 0 ) - F1temp * Construct( ConstrNum ).CTFCross( 0 );
+			// Linearized conduction at the outside face of the roof, set by CalcCTFOutFaceCoupling
+			Qsoilpart1 = CTFOutFaceCondConst( SurfNum );
+			Qsoilpart2 = CTFOutFaceCondCoef( SurfNum );
 
 			Pa = StdBaroPress; // standard atmospheric pressure (apparently in Pascals)
 			Tgk = Tg + KelvinConv;
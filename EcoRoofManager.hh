@@ -28,6 +28,18 @@ namespace EcoRoofManager {
 
 	extern Real64 Tfold; // leaf temperature from the previous time step
 	extern Real64 Tgold; // ground temperature from the previous time step
+	extern Real64 Moisture; // Near-surface soil moisture content of CalcEcoRoof (m^3/m^3)
+	extern Real64 MeanRootMoisture; // Root zone soil moisture content of CalcEcoRoof (m^3/m^3)
+	extern Real64 Vfluxf; // Water evapotr. rate associated with latent heat from vegetation of CalcEcoRoof [m/s]
+	extern Real64 Vfluxg; // Water evapotr. rate associated with latent heat from ground surface of CalcEcoRoof [m/s]
+	extern Real64 PlantCoverMoisture; // Near-surface soil moisture content of GreenRoof_with_PlantCoverage (m^3/m^3)
+	extern Real64 PlantCoverMeanRootMoisture; // Root zone soil moisture content of GreenRoof_with_PlantCoverage (m^3/m^3)
+	extern Real64 PlantCoverVfluxf; // Vegetation evapotr. rate of GreenRoof_with_PlantCoverage [m/s]
+	extern Real64 PlantCoverVfluxg; // Ground surface evapotr. rate of GreenRoof_with_PlantCoverage [m/s]
+	extern Real64 T_plant; // Plant (leaf) temperature of GreenRoof_with_PlantCoverage (K)
+	extern Real64 T_soil; // Soil surface temperature under the plants of GreenRoof_with_PlantCoverage (K)
+	extern Real64 T_bare_soil; // Bare soil surface temperature of GreenRoof_with_PlantCoverage (K)
+	extern Real64 Tsoil_avg; // Average soil temperature of GreenRoof_with_PlantCoverage (K)
 	extern bool EcoRoofbeginFlag;
 
 	// Functions
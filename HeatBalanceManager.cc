@@ -1,6 +1,20 @@
 // C++ Headers
+#include <chrono>
 #include <cmath>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
 #include <string>
+#include <vector>
+#ifdef __linux__
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -158,11 +172,10 @@ namespace HeatBalanceManager {
 	FArray1D< Real64 > TempZone; // Zone air temperature from the current warmup day
 	FArray1D< Real64 > LoadZone; // Zone load from the current warmup day
 
-	FArray2D< Real64 > TempZoneRpt; // Zone air temperature to report (average over all warmup days)
-	FArray1D< Real64 > TempZoneRptStdDev; // Zone air temperature to report (std dev over all warmup days)
-	FArray2D< Real64 > LoadZoneRpt; // Zone load to report (average over all warmup days)
-	FArray1D< Real64 > LoadZoneRptStdDev; // Zone load to report (std dev over all warmup days)
-	FArray2D< Real64 > MaxLoadZoneRpt; // Maximum zone load for reporting calcs
+	FArray1D< Real64 > TempZoneRptMean; // Running mean of the warmup temperature difference of each zone
+	FArray1D< Real64 > TempZoneRptSumSqDev; // Running sum of squared deviations from that mean
+	FArray1D< Real64 > LoadZoneRptMean; // Running mean of the relative warmup load difference of each zone
+	FArray1D< Real64 > LoadZoneRptSumSqDev; // Running sum of squared deviations from that mean
 	int CountWarmupDayPoints; // Count of warmup timesteps (to achieve warmup)
 
 	std::string CurrentModuleObject; // to assist in getting input
@@ -180,6 +193,7 @@ namespace HeatBalanceManager {
 
 	// Object Data
 	FArray1D< WarmupConvergence > WarmupConvergenceValues;
+	std::unordered_map< std::string, Window5DataFileIndex > Window5DataFiles; // Window5 data files read so far, by full file name
 
 	// MODULE SUBROUTINES:
 	//*************************************************************************
@@ -216,6 +230,7 @@ namespace HeatBalanceManager {
 		using DataGlobals::emsCallFromEndZoneTimestepBeforeZoneReporting;
 		using DataGlobals::emsCallFromEndZoneTimestepAfterZoneReporting;
 		using DataGlobals::emsCallFromBeginNewEvironmentAfterWarmUp;
+		using General::RoundSigDigits;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -232,17 +247,34 @@ namespace HeatBalanceManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool GetInputFlag( true );
+		static std::chrono::steady_clock::time_point EnvrnStartTime; // Start of the environment span of the trace
+		static std::chrono::steady_clock::time_point DayStartTime; // Start of the day span of the trace
+		static bool DayIsWarmup( false ); // True if the day of the day span is a warmup day
+		static int DayNumber( 0 ); // DayOfSim when the day of the day span started
+		std::chrono::steady_clock::time_point StepStartTime; // Start of the zone timestep span of the trace
+		std::chrono::steady_clock::time_point PhaseStartTime; // Start of a phase span of the trace
 
 		// FLOW:
 
 		// Get the heat balance input at the beginning of the simulation only
 		if ( GetInputFlag ) {
 			GetHeatBalanceInput(); // Obtains heat balance related parameters from input file
+			InitHeatBalanceTrace();
 			GetInputFlag = false;
 		}
 
+		StepStartTime = HeatBalanceTraceMark();
+		if ( BeginEnvrnFlag ) EnvrnStartTime = StepStartTime;
+		if ( BeginDayFlag ) {
+			DayStartTime = StepStartTime;
+			DayIsWarmup = WarmupFlag;
+			DayNumber = DayOfSim; // CheckWarmupConvergence may reset DayOfSim before the day span ends
+		}
+
 		// These Inits will still have to be looked at as the routines are re-engineered further
+		PhaseStartTime = HeatBalanceTraceMark();
 		InitHeatBalance(); // Initialize all heat balance related parameters
+		HeatBalanceTraceSpan( "InitHeatBalance", PhaseStartTime );
 
 		// Solve the zone heat balance by first calling the Surface Heat Balance Manager
 		// and then the Air Heat Balance Manager is called by the Surface Heat Balance
@@ -251,15 +283,21 @@ namespace HeatBalanceManager {
 		// may be a radiant system in the building which will require iteration between
 		// the HVAC system (called from the Air Heat Balance) and the zone (simulated
 		// in the Surface Heat Balance Manager).  In the future, this may be improved.
+		PhaseStartTime = HeatBalanceTraceMark();
 		ManageSurfaceHeatBalance();
+		HeatBalanceTraceSpan( "ManageSurfaceHeatBalance", PhaseStartTime );
 		ManageEMS( emsCallFromEndZoneTimestepBeforeZoneReporting ); // EMS calling point
+		PhaseStartTime = HeatBalanceTraceMark();
 		RecKeepHeatBalance(); // Do any heat balance related record keeping
+		HeatBalanceTraceSpan( "RecKeepHeatBalance", PhaseStartTime );
 
 		// This call has been moved to the FanSystemModule and does effect the output file
 		//   You do get a shift in the Air Handling System Summary for the building electric loads
 		// IF ((.NOT.WarmupFlag).AND.(DayOfSim.GT.0)) CALL RCKEEP  ! Do fan system accounting (to be moved later)
 
+		PhaseStartTime = HeatBalanceTraceMark();
 		ReportHeatBalance(); // Manage heat balance reporting until the new reporting is in place
+		HeatBalanceTraceSpan( "ReportHeatBalance", PhaseStartTime );
 
 		ManageEMS( emsCallFromEndZoneTimestepAfterZoneReporting ); // EMS calling point
 
@@ -281,6 +319,14 @@ namespace HeatBalanceManager {
 			ReportWarmupConvergence();
 		}
 
+		ManageHeatBalanceCheckpoints();
+
+		if ( HeatBalanceTraceActive ) {
+			EndHeatBalanceTraceStep( StepStartTime );
+			if ( EndDayFlag ) HeatBalanceTraceSpan( ( DayIsWarmup ? "Warmup Day " : "Day " ) + RoundSigDigits( DayNumber ), DayStartTime, false );
+			if ( EndEnvrnFlag ) HeatBalanceTraceSpan( "Environment " + EnvironmentName, EnvrnStartTime, false );
+		}
+
 	}
 
 	// Get Input Section of the Module
@@ -334,6 +380,14 @@ namespace HeatBalanceManager {
 
 		GetSiteAtmosphereData( ErrorsFound );
 
+		GetPerformancePrecisionTradeoffs( ErrorsFound );
+
+		GetSurfaceHeatBalanceCapture( ErrorsFound );
+
+		GetTimeDecomposition( ErrorsFound );
+
+		GetHeatBalanceScaling( ErrorsFound );
+
 		GetWindowGlassSpectralData( ErrorsFound );
 
 		GetMaterialData( ErrorsFound ); // Read materials from input file/transfer from legacy data structure
@@ -342,6 +396,8 @@ namespace HeatBalanceManager {
 
 		GetConstructData( ErrorsFound ); // Read constructs from input file/transfer from legacy data structure
 
+		Window5DataFiles.clear(); // Window5 data files are only searched while constructions are read
+
 		GetBuildingData( ErrorsFound ); // Read building data from input file
 
 		// Added SV 6/26/2013 to load scheduled surface gains
@@ -360,6 +416,8 @@ namespace HeatBalanceManager {
 
 		CheckUsedConstructions( ErrorsFound );
 
+		GetParametricBatch( ErrorsFound );
+
 		if ( ErrorsFound ) {
 			ShowFatalError( "Errors found in Building Input, Program Stopped" );
 		}
@@ -1175,6 +1233,289 @@ namespace HeatBalanceManager {
 
 	}
 
+	void
+	GetPerformancePrecisionTradeoffs( bool & ErrorsFound ) // Set to true if errors detected during getting data
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the PerformancePrecisionTradeoffs object, which selects optional faster
+		// methods that may change results slightly.
+
+		// METHODOLOGY EMPLOYED:
+		// The object is optional; without it every option keeps the exact method.
+
+		// Using/Aliasing
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectItem;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumObjects;
+		int NumAlphas; // Number of elements in the alpha array
+		int NumNums; // Number of elements in the numeric array
+		int IOStat; // IO Status when calling get input subroutine
+		std::string ScreenMethodName; // Window screen transmittance method, for the eio report
+		std::string PredictorName; // Inside surface temperature predictor, for the eio report
+
+		// Formats
+		static gio::Fmt Format_720( "(' Performance Precision Tradeoffs',2(',',A))" );
+
+		// FLOW:
+		CurrentModuleObject = "PerformancePrecisionTradeoffs";
+		NumObjects = GetNumObjectsFound( CurrentModuleObject );
+
+		ScreenTransMethod = ScreenTransMethodExact;
+		ScreenMethodName = "Exact";
+		InsideSurfTempPredictor = InsideSurfTempPredictorNone;
+		PredictorName = "None";
+
+		if ( NumObjects > 0 ) {
+			GetObjectItem( CurrentModuleObject, 1, cAlphaArgs, NumAlphas, rNumericArgs, NumNums, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+
+			if ( NumAlphas > 0 && ! lAlphaFieldBlanks( 1 ) ) {
+				{ auto const SELECT_CASE_var( cAlphaArgs( 1 ) );
+				if ( SELECT_CASE_var == "EXACT" ) {
+					ScreenTransMethod = ScreenTransMethodExact;
+				} else if ( SELECT_CASE_var == "TABLELOOKUP" ) {
+					ScreenTransMethod = ScreenTransMethodTableLookup;
+					ScreenMethodName = "TableLookup";
+				} else {
+					ShowSevereError( CurrentModuleObject + ": Invalid input of " + cAlphaFieldNames( 1 ) + "=\"" + cAlphaArgs( 1 ) + "\"." );
+					ShowContinueError( "Valid choices are: Exact or TableLookup." );
+					ErrorsFound = true;
+				}}
+			}
+
+			if ( NumAlphas > 1 && ! lAlphaFieldBlanks( 2 ) ) {
+				{ auto const SELECT_CASE_var( cAlphaArgs( 2 ) );
+				if ( SELECT_CASE_var == "NONE" ) {
+					InsideSurfTempPredictor = InsideSurfTempPredictorNone;
+				} else if ( SELECT_CASE_var == "LINEAR" ) {
+					InsideSurfTempPredictor = InsideSurfTempPredictorLinear;
+					PredictorName = "Linear";
+				} else if ( SELECT_CASE_var == "QUADRATIC" ) {
+					InsideSurfTempPredictor = InsideSurfTempPredictorQuadratic;
+					PredictorName = "Quadratic";
+				} else {
+					ShowSevereError( CurrentModuleObject + ": Invalid input of " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"." );
+					ShowContinueError( "Valid choices are: None, Linear or Quadratic." );
+					ErrorsFound = true;
+				}}
+			}
+		}
+
+		// Write to the initialization output file
+		gio::write( OutputFileInits, fmtA ) << "! <Performance Precision Tradeoffs>, Window Screen Transmittance Method, Inside Surface Temperature Predictor";
+		gio::write( OutputFileInits, Format_720 ) << ScreenMethodName << PredictorName;
+
+	}
+
+	void
+	GetSurfaceHeatBalanceCapture( bool & ErrorsFound ) // Set to true if errors detected during getting data
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the Output:SurfaceHeatBalanceCapture object, which selects the zone timestep at which
+		// the surface heat balance is captured to, or replayed from, a file.
+
+		// METHODOLOGY EMPLOYED:
+		// The object is optional; without it nothing is captured.  The capture itself is done by
+		// HeatBalanceSurfaceManager (StartSurfaceHeatBalanceCapture).
+
+		// Using/Aliasing
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectItem;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumAlphas; // Number of elements in the alpha array
+		int NumNums; // Number of elements in the numeric array
+		int IOStat; // IO Status when calling get input subroutine
+
+		// Formats
+		static gio::Fmt Format_720( "(' Surface Heat Balance Capture',6(',',A))" );
+
+		// FLOW:
+		CurrentModuleObject = "Output:SurfaceHeatBalanceCapture";
+		SurfaceCaptureMode = SurfaceCaptureNone;
+		if ( GetNumObjectsFound( CurrentModuleObject ) == 0 ) return;
+
+		GetObjectItem( CurrentModuleObject, 1, cAlphaArgs, NumAlphas, rNumericArgs, NumNums, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+
+		SurfaceCaptureMode = SurfaceCaptureWrite;
+		if ( NumAlphas > 0 && ! lAlphaFieldBlanks( 1 ) ) {
+			{ auto const SELECT_CASE_var( cAlphaArgs( 1 ) );
+			if ( SELECT_CASE_var == "CAPTURE" ) {
+				SurfaceCaptureMode = SurfaceCaptureWrite;
+			} else if ( SELECT_CASE_var == "REPLAY" ) {
+				SurfaceCaptureMode = SurfaceCaptureReplay;
+			} else {
+				ShowSevereError( CurrentModuleObject + ": Invalid input of " + cAlphaFieldNames( 1 ) + "=\"" + cAlphaArgs( 1 ) + "\"." );
+				ShowContinueError( "Valid choices are: Capture or Replay." );
+				ErrorsFound = true;
+			}}
+		}
+		if ( NumAlphas < 2 || lAlphaFieldBlanks( 2 ) ) {
+			ShowSevereError( CurrentModuleObject + ": " + cAlphaFieldNames( 2 ) + " is required." );
+			ErrorsFound = true;
+		} else {
+			SurfaceCaptureFileName = cAlphaArgs( 2 );
+		}
+
+		SurfaceCaptureDay = ( NumNums > 0 && ! lNumericFieldBlanks( 1 ) ) ? int( rNumericArgs( 1 ) ) : 1;
+		SurfaceCaptureHour = ( NumNums > 1 && ! lNumericFieldBlanks( 2 ) ) ? int( rNumericArgs( 2 ) ) : 12;
+		SurfaceCaptureTimeStep = ( NumNums > 2 && ! lNumericFieldBlanks( 3 ) ) ? int( rNumericArgs( 3 ) ) : 1;
+		SurfaceCaptureRepetitions = ( NumNums > 3 && ! lNumericFieldBlanks( 4 ) ) ? int( rNumericArgs( 4 ) ) : 1000;
+		if ( SurfaceCaptureTimeStep > NumOfTimeStepInHour ) {
+			ShowSevereError( CurrentModuleObject + ": " + cNumericFieldNames( 3 ) + "=[" + RoundSigDigits( SurfaceCaptureTimeStep ) + "] exceeds the number of timesteps per hour [" + RoundSigDigits( NumOfTimeStepInHour ) + "]." );
+			ErrorsFound = true;
+		}
+
+		// Write to the initialization output file
+		gio::write( OutputFileInits, fmtA ) << "! <Surface Heat Balance Capture>, Mode, File Name, Day of Simulation, Hour, Time Step, Repetitions";
+		gio::write( OutputFileInits, Format_720 ) << ( SurfaceCaptureMode == SurfaceCaptureReplay ? "Replay" : "Capture" ) << SurfaceCaptureFileName << RoundSigDigits( SurfaceCaptureDay ) << RoundSigDigits( SurfaceCaptureHour ) << RoundSigDigits( SurfaceCaptureTimeStep ) << RoundSigDigits( SurfaceCaptureRepetitions );
+
+	}
+
+	void
+	GetTimeDecomposition( bool & ErrorsFound ) // Set to true if errors detected during getting data
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the HeatBalance:TimeDecomposition object, which makes this run one chunk (or the
+		// serial reference) of a run period split into chunks.
+
+		// METHODOLOGY EMPLOYED:
+		// The object is optional.  The chunk plan is echoed to the eio file; the days a chunk run
+		// contributes to the stitched results are First Day to Last Day of the full run period.
+		// The chunk boundaries are handled by HeatBalanceSurfaceManager (ManageHeatBalanceCheckpoints).
+
+		// Using/Aliasing
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectItem;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumAlphas; // Number of elements in the alpha array
+		int NumNums; // Number of elements in the numeric array
+		int IOStat; // IO Status when calling get input subroutine
+		int StartBoundary; // Day of the full run period at whose end the chunk starts
+
+		// Formats
+		static gio::Fmt Format_720( "(' Heat Balance Time Decomposition',6(',',A))" );
+
+		// FLOW:
+		CurrentModuleObject = "HeatBalance:TimeDecomposition";
+		TimeDecompositionUsed = false;
+		if ( GetNumObjectsFound( CurrentModuleObject ) == 0 ) return;
+
+		GetObjectItem( CurrentModuleObject, 1, cAlphaArgs, NumAlphas, rNumericArgs, NumNums, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+
+		TimeDecompositionUsed = true;
+		if ( NumAlphas < 1 || lAlphaFieldBlanks( 1 ) ) {
+			ShowSevereError( CurrentModuleObject + ": " + cAlphaFieldNames( 1 ) + " is required." );
+			ErrorsFound = true;
+		} else {
+			CheckpointFilePrefix = cAlphaArgs( 1 );
+		}
+		CheckpointReferencePrefix = ( NumAlphas > 1 && ! lAlphaFieldBlanks( 2 ) ) ? cAlphaArgs( 2 ) : "";
+
+		ChunkLength = ( NumNums > 0 && ! lNumericFieldBlanks( 1 ) ) ? int( rNumericArgs( 1 ) ) : 0;
+		ChunkNumber = ( NumNums > 1 && ! lNumericFieldBlanks( 2 ) ) ? int( rNumericArgs( 2 ) ) : 0;
+		ChunkOverlapDays = ( NumNums > 2 && ! lNumericFieldBlanks( 3 ) ) ? int( rNumericArgs( 3 ) ) : 0;
+		if ( ChunkLength < 1 ) {
+			ShowSevereError( CurrentModuleObject + ": " + cNumericFieldNames( 1 ) + " must be at least 1 day." );
+			ErrorsFound = true;
+			return;
+		}
+		if ( ChunkNumber < 0 || ChunkOverlapDays < 0 ) {
+			ShowSevereError( CurrentModuleObject + ": " + cNumericFieldNames( 2 ) + " and " + cNumericFieldNames( 3 ) + " cannot be negative." );
+			ErrorsFound = true;
+			return;
+		}
+		StartBoundary = max( ChunkNumber - 1, 0 ) * ChunkLength;
+		if ( ChunkOverlapDays > StartBoundary ) {
+			if ( ChunkNumber > 1 ) {
+				ShowWarningError( CurrentModuleObject + ": " + cNumericFieldNames( 3 ) + "=[" + RoundSigDigits( ChunkOverlapDays ) + "] starts before the run period; " + RoundSigDigits( StartBoundary ) + " will be used." );
+			}
+			ChunkOverlapDays = StartBoundary;
+		}
+
+		// Write to the initialization output file
+		gio::write( OutputFileInits, fmtA ) << "! <Heat Balance Time Decomposition>, Chunk, Chunk Length {days}, First Day, Last Day, Overlap Days, Start";
+		if ( ChunkNumber == 0 ) {
+			gio::write( OutputFileInits, Format_720 ) << "0" << RoundSigDigits( ChunkLength ) << "1" << "End of Run Period" << "0" << "Warmup";
+		} else {
+			gio::write( OutputFileInits, Format_720 ) << RoundSigDigits( ChunkNumber ) << RoundSigDigits( ChunkLength ) << RoundSigDigits( StartBoundary + 1 ) << RoundSigDigits( ChunkNumber * ChunkLength ) << RoundSigDigits( ChunkOverlapDays ) << ( ( StartBoundary > 0 && ChunkOverlapDays == 0 ) ? "Checkpoint" : "Warmup" );
+		}
+
+	}
+
+	void
+	GetHeatBalanceScaling( bool & ErrorsFound ) // Set to true if errors detected during getting data
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the Output:HeatBalanceScaling object, which names the CSV file that collects one row
+		// per environment for comparing runs of one building at several sizes.
+
+		// METHODOLOGY EMPLOYED:
+		// The object is optional.  The rows are written by HeatBalanceSurfaceManager
+		// (ReportHeatBalanceScaling).
+
+		// Using/Aliasing
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectItem;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumAlphas; // Number of elements in the alpha array
+		int NumNums; // Number of elements in the numeric array
+		int IOStat; // IO Status when calling get input subroutine
+
+		// FLOW:
+		CurrentModuleObject = "Output:HeatBalanceScaling";
+		HeatBalanceScalingFileName = "";
+		HeatBalanceScalingCase = "";
+		if ( GetNumObjectsFound( CurrentModuleObject ) == 0 ) return;
+
+		GetObjectItem( CurrentModuleObject, 1, cAlphaArgs, NumAlphas, rNumericArgs, NumNums, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+
+		if ( NumAlphas < 1 || lAlphaFieldBlanks( 1 ) ) {
+			ShowSevereError( CurrentModuleObject + ": " + cAlphaFieldNames( 1 ) + " is required." );
+			ErrorsFound = true;
+			return;
+		}
+		HeatBalanceScalingFileName = cAlphaArgs( 1 );
+		if ( NumAlphas > 1 && ! lAlphaFieldBlanks( 2 ) ) HeatBalanceScalingCase = cAlphaArgs( 2 );
+
+	}
+
 	void
 	GetMaterialData( bool & ErrorsFound ) // set to true if errors found in input
 	{
@@ -3925,6 +4266,627 @@ namespace HeatBalanceManager {
 
 	}
 
+	void
+	GetParametricBatch( bool & ErrorsFound ) // If errors found in input
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the HeatBalance:ParametricBatch and HeatBalance:ParametricVariant objects, which make
+		// this run also simulate variants of its input that differ only in material properties.
+
+		// METHODOLOGY EMPLOYED:
+		// Both objects are optional.  Every override is checked against the processed materials
+		// (CheckMaterialOverride) here, so that a bad variant stops the run before any process is forked.
+		// The variants are run by RunParametricBatch.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectItem;
+		using InputProcessor::VerifyName;
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumAlphas; // Number of elements in the alpha array
+		int NumNums; // Number of elements in the numeric array
+		int IOStat; // IO Status when calling get input subroutine
+		int VariantNum; // Loop counter
+		int OverrideNum; // Loop counter
+		bool IsNotOK; // Flag to verify name
+		bool IsBlank; // Flag for blank name
+		bool OverrideErrors; // True if CheckMaterialOverride rejected the override
+
+		// Formats
+		static gio::Fmt Format_750( "('! <Parametric Variant>, Name, Material Name, Field Name, Value')" );
+		static gio::Fmt Format_751( "(' Parametric Variant',4(',',A))" );
+
+		// FLOW:
+		CurrentModuleObject = "HeatBalance:ParametricVariant";
+		TotParametricVariants = GetNumObjectsFound( CurrentModuleObject );
+		if ( TotParametricVariants == 0 ) return;
+
+		ParametricVariant.allocate( TotParametricVariants );
+		gio::write( OutputFileInits, Format_750 );
+		for ( VariantNum = 1; VariantNum <= TotParametricVariants; ++VariantNum ) {
+			GetObjectItem( CurrentModuleObject, VariantNum, cAlphaArgs, NumAlphas, rNumericArgs, NumNums, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+			IsNotOK = false;
+			IsBlank = false;
+			VerifyName( cAlphaArgs( 1 ), ParametricVariant.Name(), VariantNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			if ( IsNotOK ) {
+				ErrorsFound = true;
+				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
+			}
+			auto & variant( ParametricVariant( VariantNum ) );
+			variant.Name = cAlphaArgs( 1 );
+			variant.NumOverrides = min( ( NumAlphas - 1 ) / 2, NumNums );
+			variant.MaterialName.allocate( variant.NumOverrides );
+			variant.FieldName.allocate( variant.NumOverrides );
+			variant.Value.allocate( variant.NumOverrides );
+			for ( OverrideNum = 1; OverrideNum <= variant.NumOverrides; ++OverrideNum ) {
+				variant.MaterialName( OverrideNum ) = cAlphaArgs( 2 * OverrideNum );
+				variant.FieldName( OverrideNum ) = cAlphaArgs( 2 * OverrideNum + 1 );
+				variant.Value( OverrideNum ) = rNumericArgs( OverrideNum );
+				OverrideErrors = false;
+				CheckMaterialOverride( variant.MaterialName( OverrideNum ), variant.FieldName( OverrideNum ), variant.Value( OverrideNum ), OverrideErrors );
+				if ( OverrideErrors ) {
+					ShowContinueError( "...in " + CurrentModuleObject + "=\"" + variant.Name + "\"." );
+					ErrorsFound = true;
+					continue;
+				}
+				gio::write( OutputFileInits, Format_751 ) << variant.Name << variant.MaterialName( OverrideNum ) << variant.FieldName( OverrideNum ) << RoundSigDigits( variant.Value( OverrideNum ), 4 );
+			}
+			if ( variant.NumOverrides == 0 ) {
+				ShowWarningError( CurrentModuleObject + "=\"" + variant.Name + "\" has no material overrides; it repeats the base case." );
+			}
+		}
+
+		CurrentModuleObject = "HeatBalance:ParametricBatch";
+		MaxConcurrentVariants = 0;
+		if ( GetNumObjectsFound( CurrentModuleObject ) > 0 ) {
+			GetObjectItem( CurrentModuleObject, 1, cAlphaArgs, NumAlphas, rNumericArgs, NumNums, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+			if ( NumNums > 0 && ! lNumericFieldBlanks( 1 ) ) MaxConcurrentVariants = max( int( rNumericArgs( 1 ) ), 0 );
+		}
+
+	}
+
+	void
+	RunParametricBatch()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Runs every HeatBalance:ParametricVariant in its own process, forked from this one once the
+		// input is processed and the heat balance is initialized, so that the variants do not repeat
+		// the input processing, shading and window setup of the base case.
+
+		// METHODOLOGY EMPLOYED:
+		// The directory of each variant is created and a child is forked for it, with at most
+		// MaxConcurrentVariants children (the number of processors when 0) running at a time.
+		// A child returns from here into the simulation as its variant (StartParametricVariant) and
+		// never gets to the rest of this routine.  The parent waits for all of its children, writes
+		// their exit status to the eio file and returns to simulate the base case.
+		// fork and waitpid are POSIX and the output files are found through /proc, so on other
+		// systems the variants are not run.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "RunParametricBatch: " );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int VariantNum; // Loop counter
+		int MaxRunning; // Children allowed to run at the same time
+		int NumRunning; // Children running
+		std::string Result; // Outcome of a variant for the eio file
+
+		// Formats
+		static gio::Fmt Format_752( "(' Parametric Variant Result',4(',',A))" );
+
+		// FLOW:
+#ifdef __linux__
+		DisplayString( "Running " + RoundSigDigits( TotParametricVariants ) + " Parametric Variants" );
+		MaxRunning = MaxConcurrentVariants;
+		if ( MaxRunning <= 0 ) MaxRunning = max( int( sysconf( _SC_NPROCESSORS_ONLN ) ), 1 );
+		NumRunning = 0;
+		for ( VariantNum = 1; VariantNum <= TotParametricVariants; ++VariantNum ) {
+			auto & variant( ParametricVariant( VariantNum ) );
+			if ( mkdir( variant.Name.c_str(), 0777 ) != 0 && errno != EEXIST ) {
+				ShowSevereError( RoutineName + "Cannot create the directory \"" + variant.Name + "\"; HeatBalance:ParametricVariant=\"" + variant.Name + "\" is not run." );
+				continue;
+			}
+			if ( NumRunning == MaxRunning ) {
+				WaitForParametricVariant();
+				--NumRunning;
+			}
+			pid_t const ProcessID( fork() );
+			if ( ProcessID == 0 ) {
+				StartParametricVariant( VariantNum );
+				return;
+			}
+			if ( ProcessID < 0 ) {
+				ShowSevereError( RoutineName + "Cannot start a process for HeatBalance:ParametricVariant=\"" + variant.Name + "\"; it is not run." );
+				continue;
+			}
+			variant.ProcessID = ProcessID;
+			++NumRunning;
+		}
+		while ( NumRunning > 0 ) {
+			WaitForParametricVariant();
+			--NumRunning;
+		}
+
+		gio::write( OutputFileInits, fmtA ) << "! <Parametric Variant Result>, Name, Output Directory, Exit Status, Result";
+		for ( VariantNum = 1; VariantNum <= TotParametricVariants; ++VariantNum ) {
+			auto const & variant( ParametricVariant( VariantNum ) );
+			if ( variant.ProcessID == 0 ) {
+				Result = "Not Run";
+			} else if ( variant.ExitStatus == 0 ) {
+				Result = "Completed";
+			} else {
+				Result = "Failed";
+				ShowWarningError( RoutineName + "HeatBalance:ParametricVariant=\"" + variant.Name + "\" did not complete; see the err file in its directory." );
+			}
+			gio::write( OutputFileInits, Format_752 ) << variant.Name << variant.Name << RoundSigDigits( variant.ExitStatus ) << Result;
+		}
+		DisplayString( "Parametric Variants Finished, Continuing with the Base Case" );
+#else
+		ShowWarningError( RoutineName + "HeatBalance:ParametricVariant objects can only be run on Linux; they are ignored." );
+#endif
+
+	}
+
+	void
+	WaitForParametricVariant()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Waits for one child of RunParametricBatch to end and records its exit status.
+
+		// METHODOLOGY EMPLOYED:
+		// A child killed by a signal, or one waitpid cannot report on, keeps an exit status of -1.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		// FLOW:
+#ifdef __linux__
+		int VariantNum; // Loop counter
+		int Status( 0 ); // Status reported by waitpid
+		pid_t ProcessID; // Child that ended
+		do {
+			ProcessID = waitpid( -1, &Status, 0 );
+		} while ( ProcessID < 0 && errno == EINTR );
+		if ( ProcessID <= 0 ) return;
+		for ( VariantNum = 1; VariantNum <= TotParametricVariants; ++VariantNum ) {
+			auto & variant( ParametricVariant( VariantNum ) );
+			if ( variant.ProcessID != ProcessID ) continue;
+			variant.ExitStatus = WIFEXITED( Status ) ? WEXITSTATUS( Status ) : -1;
+			break;
+		}
+#endif
+
+	}
+
+	void
+	StartParametricVariant( int const VariantNum ) // Variant simulated by this (child) process
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Turns a process forked by RunParametricBatch into a run of one variant: its output goes to the
+		// variant directory, its materials are changed and its conduction transfer functions are
+		// recomputed before the simulation goes on.
+
+		// METHODOLOGY EMPLOYED:
+		// Every regular file the child inherited is given a file description of its own.  Output files
+		// of the run directory are copied into the variant directory and the copy takes the place of
+		// the original descriptor at the same offset, so what the parent had written so far, and what
+		// is still buffered in the inherited streams, ends up in the variant's files.  Other files, such
+		// as the weather file, are reopened at the same offset so that the variants do not move each
+		// other's read position.  The process then changes to the variant directory, which receives
+		// any file opened later, and applies the material overrides.
+		// InitConductionTransferFunctions has no entry point for a single construction, so the CTFs of
+		// all constructions are recomputed.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using ConductionTransferFunctionCalc::InitConductionTransferFunctions;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "StartParametricVariant: " );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int OverrideNum; // Loop counter
+		bool ErrorsFound( false ); // True if an override could not be applied
+
+		// Formats
+		static gio::Fmt Format_753( "(' Parametric Variant Run',1(',',A))" );
+
+		// FLOW:
+		ParametricVariantNum = VariantNum;
+		auto const & variant( ParametricVariant( VariantNum ) );
+#ifdef __linux__
+		if ( ! RedirectParametricVariantFiles( variant.Name ) || chdir( variant.Name.c_str() ) != 0 ) {
+			ShowFatalError( RoutineName + "Cannot move the output of HeatBalance:ParametricVariant=\"" + variant.Name + "\" to its directory." );
+		}
+#endif
+
+		gio::write( OutputFileInits, fmtA ) << "! <Parametric Variant Run>, Name";
+		gio::write( OutputFileInits, Format_753 ) << variant.Name;
+		for ( OverrideNum = 1; OverrideNum <= variant.NumOverrides; ++OverrideNum ) {
+			ApplyMaterialOverride( variant.MaterialName( OverrideNum ), variant.FieldName( OverrideNum ), variant.Value( OverrideNum ), ErrorsFound );
+		}
+		if ( ErrorsFound ) {
+			ShowFatalError( RoutineName + "Errors found applying HeatBalance:ParametricVariant=\"" + variant.Name + "\", Program Stopped" );
+		}
+
+		if ( any_eq( HeatTransferAlgosUsed, UseCTF ) || any_eq( HeatTransferAlgosUsed, UseEMPD ) ) {
+			DisplayString( "Initializing Response Factors for Parametric Variant " + variant.Name );
+			InitConductionTransferFunctions();
+		}
+
+	}
+
+	bool
+	RedirectParametricVariantFiles( std::string const & Directory ) // Directory of the variant, relative to the run directory
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives every regular file open in this process a file description of its own, with output
+		// files of the run directory replaced by copies in Directory (see StartParametricVariant).
+		// Returns false if the open files cannot be listed or an output file cannot be copied.
+
+		// METHODOLOGY EMPLOYED:
+		// The descriptors are listed from /proc/self/fd before any of them is replaced.  The new file
+		// is opened with the access mode of the old one and moved onto its descriptor with dup2.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Return value
+		bool Redirected( true );
+
+#ifdef __linux__
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::vector< int > FileDescriptors; // Descriptors open in this process
+		std::string RunDirectory; // Run directory, with a trailing slash
+		std::string FilePath; // File open on a descriptor
+		std::string CopyPath; // Its copy in the variant directory
+		char PathBuffer[ PATH_MAX + 1 ]; // Buffer for getcwd and readlink
+		char CopyBuffer[ 65536 ]; // Buffer for copying an output file
+		struct stat FileStatus; // Status of the file open on a descriptor
+		int Flags; // File status flags of a descriptor
+		int NewDescriptor; // Descriptor of the new file
+		int OldDescriptor; // Separate descriptor for reading the old file
+		off_t Offset; // File offset of a descriptor
+		off_t Copied; // Bytes copied so far
+		ssize_t Length; // Bytes read or path length
+
+		if ( getcwd( PathBuffer, sizeof( PathBuffer ) ) == nullptr ) return false;
+		RunDirectory = std::string( PathBuffer ) + '/';
+		DIR * FdDirectory( opendir( "/proc/self/fd" ) );
+		if ( FdDirectory == nullptr ) return false;
+		while ( struct dirent * Entry = readdir( FdDirectory ) ) {
+			if ( Entry->d_name[ 0 ] < '0' || Entry->d_name[ 0 ] > '9' ) continue;
+			int const FileDescriptor( std::atoi( Entry->d_name ) );
+			if ( FileDescriptor > 2 && FileDescriptor != dirfd( FdDirectory ) ) FileDescriptors.push_back( FileDescriptor );
+		}
+		closedir( FdDirectory );
+
+		for ( int const FileDescriptor : FileDescriptors ) {
+			if ( fstat( FileDescriptor, &FileStatus ) != 0 || ! S_ISREG( FileStatus.st_mode ) ) continue;
+			Length = readlink( ( "/proc/self/fd/" + std::to_string( FileDescriptor ) ).c_str(), PathBuffer, PATH_MAX );
+			Flags = fcntl( FileDescriptor, F_GETFL );
+			Offset = lseek( FileDescriptor, 0, SEEK_CUR );
+			if ( Length <= 0 || Flags == -1 || Offset < 0 ) continue;
+			FilePath.assign( PathBuffer, Length );
+
+			if ( ( Flags & O_ACCMODE ) != O_RDONLY && FilePath.compare( 0, RunDirectory.size(), RunDirectory ) == 0 && FilePath.find( '/', RunDirectory.size() ) == std::string::npos ) {
+				// Output file of the run directory: continue it in a copy in the variant directory
+				CopyPath = RunDirectory + Directory + '/' + FilePath.substr( RunDirectory.size() );
+				NewDescriptor = open( CopyPath.c_str(), ( Flags & ( O_ACCMODE | O_APPEND ) ) | O_CREAT | O_TRUNC, 0666 );
+				OldDescriptor = open( FilePath.c_str(), O_RDONLY );
+				if ( NewDescriptor < 0 || OldDescriptor < 0 ) {
+					Redirected = false;
+				} else {
+					Copied = 0;
+					while ( ( Length = pread( OldDescriptor, CopyBuffer, sizeof( CopyBuffer ), Copied ) ) > 0 ) {
+						if ( write( NewDescriptor, CopyBuffer, Length ) != Length ) {
+							Redirected = false;
+							break;
+						}
+						Copied += Length;
+					}
+					if ( Length < 0 ) Redirected = false;
+				}
+				if ( OldDescriptor >= 0 ) close( OldDescriptor );
+			} else {
+				// Any other file: reopen it so that the variants keep their own file offsets
+				NewDescriptor = open( FilePath.c_str(), Flags & ( O_ACCMODE | O_APPEND ) );
+			}
+			if ( NewDescriptor < 0 ) continue;
+			if ( lseek( NewDescriptor, Offset, SEEK_SET ) != Offset || dup2( NewDescriptor, FileDescriptor ) < 0 ) Redirected = false;
+			close( NewDescriptor );
+		}
+#else
+		Redirected = false;
+#endif
+
+		return Redirected;
+
+	}
+
+	int
+	CheckMaterialOverride(
+		std::string const & MaterialName, // Name of the Material or Material:RoofVegetation to change
+		std::string const & FieldName, // IDD field name of the property to change
+		Real64 const Value, // New value of the property
+		bool & ErrorsFound // Set to true if the override cannot be applied
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Checks that a material override can be applied by ApplyMaterialOverride and returns the
+		// material number, or 0 (with ErrorsFound set) if it cannot.
+
+		// METHODOLOGY EMPLOYED:
+		// The material must be an opaque or roof vegetation material, the field one of the properties
+		// ApplyMaterialOverride changes and the value in the range the IDD allows for that field.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::MakeUPPERCase;
+		using General::RoundSigDigits;
+
+		// Return value
+		int MaterNum; // Material being changed
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "CheckMaterialOverride: " );
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		bool FieldFound; // True if FieldName is a property that can be overridden
+		bool ValueValid; // True if Value is in range for FieldName
+		Real64 NewThickness; // Thickness of the material after the override
+		Real64 NewConductivity; // Conductivity of the material after the override
+		std::string const FieldNameUC( MakeUPPERCase( FieldName ) );
+
+		// FLOW:
+		MaterNum = FindItemInList( MaterialName, Material.Name(), TotMaterials );
+		if ( MaterNum == 0 ) {
+			ShowSevereError( RoutineName + "Material=\"" + MaterialName + "\" was not found." );
+			ErrorsFound = true;
+			return 0;
+		}
+		auto const & mat( Material( MaterNum ) );
+		if ( mat.Group != RegularMaterial && mat.Group != EcoRoof ) {
+			ShowSevereError( RoutineName + "Material=\"" + MaterialName + "\" is not a Material or Material:RoofVegetation." );
+			ErrorsFound = true;
+			return 0;
+		}
+
+		// Check the field and the value before anything is changed
+		FieldFound = true;
+		ValueValid = true;
+		NewThickness = mat.Thickness;
+		NewConductivity = mat.Conductivity;
+		if ( FieldNameUC == "THICKNESS" ) {
+			NewThickness = Value;
+			ValueValid = ( Value > 0.0 );
+		} else if ( FieldNameUC == "CONDUCTIVITY" ) {
+			NewConductivity = Value;
+			ValueValid = ( Value > 0.0 );
+		} else if ( FieldNameUC == "DENSITY" || FieldNameUC == "SPECIFIC HEAT" ) {
+			ValueValid = ( Value > 0.0 );
+		} else if ( FieldNameUC == "THERMAL ABSORPTANCE" || FieldNameUC == "SOLAR ABSORPTANCE" || FieldNameUC == "VISIBLE ABSORPTANCE" ) {
+			ValueValid = ( Value >= 0.0 && Value <= 1.0 );
+		} else if ( mat.Group == EcoRoof ) {
+			if ( FieldNameUC == "HEIGHT OF PLANTS" || FieldNameUC == "LEAF AREA INDEX" || FieldNameUC == "MINIMUM STOMATAL RESISTANCE" ) {
+				ValueValid = ( Value > 0.0 );
+			} else if ( FieldNameUC == "LEAF REFLECTIVITY" || FieldNameUC == "LEAF EMISSIVITY" || FieldNameUC == "INITIAL VOLUMETRIC MOISTURE CONTENT OF THE SOIL LAYER" ) {
+				ValueValid = ( Value > 0.0 && Value <= 1.0 );
+			} else {
+				FieldFound = false;
+			}
+		} else {
+			FieldFound = false;
+		}
+		if ( ! FieldFound ) {
+			ShowSevereError( RoutineName + "Material=\"" + MaterialName + "\", field \"" + FieldName + "\" cannot be overridden." );
+			ErrorsFound = true;
+			return 0;
+		}
+		if ( ! ValueValid ) {
+			ShowSevereError( RoutineName + "Material=\"" + MaterialName + "\", field \"" + FieldName + "\", value=" + RoundSigDigits( Value, 4 ) + " is out of range." );
+			ErrorsFound = true;
+			return 0;
+		}
+		if ( NewThickness <= 0.0 || NewConductivity <= 0.0 ) {
+			ShowSevereError( RoutineName + "Material=\"" + MaterialName + "\" needs a positive Thickness and Conductivity." );
+			ErrorsFound = true;
+			return 0;
+		}
+
+		return MaterNum;
+
+	}
+
+	void
+	ApplyMaterialOverride(
+		std::string const & MaterialName, // Name of the Material or Material:RoofVegetation to change
+		std::string const & FieldName, // IDD field name of the property to change
+		Real64 const Value, // New value of the property
+		bool & ErrorsFound // Set to true if the override cannot be applied
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Changes one property of an opaque or roof vegetation material after GetHeatBalanceInput,
+		// so that a parametric variant can reuse the processed input of a base run instead of
+		// re-reading the whole input file.
+
+		// METHODOLOGY EMPLOYED:
+		// Nothing is changed unless CheckMaterialOverride accepts the override.  The material is
+		// updated in place, its nominal resistance is recalculated, and the nominal U value and derived
+		// layer properties (CheckAndSetConstructionProperties) are refreshed for every construction
+		// that uses it.  Conduction transfer functions already computed for those constructions no
+		// longer match and have to be recomputed by the caller (StartParametricVariant).
+		// Geometry, shading and window optics are not affected by these properties.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::MakeUPPERCase;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int MaterNum; // Material being changed
+		int ConstrNum; // Construction loop counter
+		int Layer; // Layer loop counter
+		bool UsesMaterial; // True if the construction has the material as one of its layers
+		std::string const FieldNameUC( MakeUPPERCase( FieldName ) );
+
+		// FLOW:
+		MaterNum = CheckMaterialOverride( MaterialName, FieldName, Value, ErrorsFound );
+		if ( MaterNum == 0 ) return;
+		auto & mat( Material( MaterNum ) );
+
+		if ( FieldNameUC == "THICKNESS" ) {
+			mat.Thickness = Value;
+		} else if ( FieldNameUC == "CONDUCTIVITY" ) {
+			mat.Conductivity = Value;
+		} else if ( FieldNameUC == "DENSITY" ) {
+			mat.Density = Value;
+		} else if ( FieldNameUC == "SPECIFIC HEAT" ) {
+			mat.SpecHeat = Value;
+		} else if ( FieldNameUC == "THERMAL ABSORPTANCE" ) {
+			mat.AbsorpThermal = Value;
+			mat.AbsorpThermalInput = Value;
+		} else if ( FieldNameUC == "SOLAR ABSORPTANCE" ) {
+			mat.AbsorpSolar = Value;
+			mat.AbsorpSolarInput = Value;
+		} else if ( FieldNameUC == "VISIBLE ABSORPTANCE" ) {
+			mat.AbsorpVisible = Value;
+			mat.AbsorpVisibleInput = Value;
+		} else if ( FieldNameUC == "HEIGHT OF PLANTS" ) {
+			mat.HeightOfPlants = Value;
+		} else if ( FieldNameUC == "LEAF AREA INDEX" ) {
+			mat.LAI = Value;
+		} else if ( FieldNameUC == "LEAF REFLECTIVITY" ) {
+			mat.Lreflectivity = Value;
+		} else if ( FieldNameUC == "LEAF EMISSIVITY" ) {
+			mat.LEmissitivity = Value;
+		} else if ( FieldNameUC == "MINIMUM STOMATAL RESISTANCE" ) {
+			mat.RStomata = Value;
+		} else if ( FieldNameUC == "INITIAL VOLUMETRIC MOISTURE CONTENT OF THE SOIL LAYER" ) {
+			mat.InitMoisture = Value;
+		}
+		NominalR( MaterNum ) = mat.Thickness / mat.Conductivity;
+		mat.Resistance = NominalR( MaterNum );
+
+		for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) {
+			auto const & construct( Construct( ConstrNum ) );
+			if ( construct.TypeIsWindow ) continue;
+			UsesMaterial = false;
+			for ( Layer = 1; Layer <= construct.TotLayers; ++Layer ) {
+				if ( construct.LayerPoint( Layer ) == MaterNum ) UsesMaterial = true;
+			}
+			if ( ! UsesMaterial ) continue;
+			NominalRforNominalUCalculation( ConstrNum ) = 0.0;
+			for ( Layer = 1; Layer <= construct.TotLayers; ++Layer ) {
+				NominalRforNominalUCalculation( ConstrNum ) += NominalR( construct.LayerPoint( Layer ) );
+			}
+			NominalU( ConstrNum ) = 1.0 / NominalRforNominalUCalculation( ConstrNum );
+			CheckAndSetConstructionProperties( ConstrNum, ErrorsFound );
+		}
+
+	}
+
 	void
 	GetBuildingData( bool & ErrorsFound ) // If errors found in input
 	{
@@ -3966,6 +4928,9 @@ namespace HeatBalanceManager {
 
 		SetupZoneGeometry( ErrorsFound );
 
+		// Reverse (interzone) constructions are created during surface input; release their spare capacity
+		TrimConstructionStorage();
+
 	}
 
 	void
@@ -4427,6 +5392,7 @@ namespace HeatBalanceManager {
 			DisplayString( "Initializing Solar Calculations" );
 			InitSolarCalculations(); // Initialize the shadowing calculations
 
+			if ( TotParametricVariants > 0 ) RunParametricBatch(); // Fork the parametric variants
 		}
 
 		if ( BeginEnvrnFlag ) {
@@ -4447,9 +5413,10 @@ namespace HeatBalanceManager {
 			TempZoneSecPrevDay = -9999.0;
 			WarmupTempDiff = 0.0;
 			WarmupLoadDiff = 0.0;
-			TempZoneRpt = 0.0;
-			LoadZoneRpt = 0.0;
-			MaxLoadZoneRpt = 0.0;
+			TempZoneRptMean = 0.0;
+			TempZoneRptSumSqDev = 0.0;
+			LoadZoneRptMean = 0.0;
+			LoadZoneRptSumSqDev = 0.0;
 			CountWarmupDayPoints = 0;
 
 			SurfaceWindow.ThetaFace() = 296.15;
@@ -4615,12 +5582,11 @@ namespace HeatBalanceManager {
 		WarmupLoadDiff.dimension( NumOfZones, 0.0 );
 		TempZone.dimension( NumOfZones, 0.0 );
 		LoadZone.dimension( NumOfZones, 0.0 );
-		TempZoneRpt.dimension( NumOfTimeStepInHour * 24, NumOfZones, 0.0 );
-		LoadZoneRpt.dimension( NumOfTimeStepInHour * 24, NumOfZones, 0.0 );
-		MaxLoadZoneRpt.dimension( NumOfTimeStepInHour * 24, NumOfZones, 0.0 );
+		TempZoneRptMean.dimension( NumOfZones, 0.0 );
+		TempZoneRptSumSqDev.dimension( NumOfZones, 0.0 );
+		LoadZoneRptMean.dimension( NumOfZones, 0.0 );
+		LoadZoneRptSumSqDev.dimension( NumOfZones, 0.0 );
 		WarmupConvergenceValues.allocate( NumOfZones );
-		TempZoneRptStdDev.allocate( NumOfTimeStepInHour * 24 );
-		LoadZoneRptStdDev.allocate( NumOfTimeStepInHour * 24 );
 		//MassConservation.allocate( NumOfZones );
 
 		CountWarmupDayPoints = 0;
@@ -4674,6 +5640,8 @@ namespace HeatBalanceManager {
 		//  CHARACTER(len=MaxNameLength) :: ZoneName
 		int ZoneNum;
 		static bool FirstWarmupWrite( true );
+		Real64 RelLoadDiff; // Warmup load difference relative to the current zone load
+		Real64 Delta; // Deviation from the running mean before it is updated
 
 		// Formats
 		static gio::Fmt Format_731( "(' Warmup Convergence Information, ',A,',',A,',',A,',',A,',',A)" );
@@ -4710,9 +5678,18 @@ namespace HeatBalanceManager {
 				WarmupTempDiff( ZoneNum ) = std::abs( TempZoneSecPrevDay( ZoneNum ) - TempZonePrevDay( ZoneNum ) );
 				WarmupLoadDiff( ZoneNum ) = std::abs( LoadZoneSecPrevDay( ZoneNum ) - LoadZonePrevDay( ZoneNum ) );
 				if ( ZoneNum == 1 ) ++CountWarmupDayPoints;
-				TempZoneRpt( CountWarmupDayPoints, ZoneNum ) = WarmupTempDiff( ZoneNum );
-				LoadZoneRpt( CountWarmupDayPoints, ZoneNum ) = WarmupLoadDiff( ZoneNum );
-				MaxLoadZoneRpt( CountWarmupDayPoints, ZoneNum ) = LoadZone( ZoneNum );
+				// Update the running mean and sum of squared deviations (Welford) used by ReportWarmupConvergence
+				Delta = WarmupTempDiff( ZoneNum ) - TempZoneRptMean( ZoneNum );
+				TempZoneRptMean( ZoneNum ) += Delta / double( CountWarmupDayPoints );
+				TempZoneRptSumSqDev( ZoneNum ) += Delta * ( WarmupTempDiff( ZoneNum ) - TempZoneRptMean( ZoneNum ) );
+				if ( LoadZone( ZoneNum ) > 1.e-4 ) {
+					RelLoadDiff = WarmupLoadDiff( ZoneNum ) / LoadZone( ZoneNum );
+				} else {
+					RelLoadDiff = 0.0;
+				}
+				Delta = RelLoadDiff - LoadZoneRptMean( ZoneNum );
+				LoadZoneRptMean( ZoneNum ) += Delta / double( CountWarmupDayPoints );
+				LoadZoneRptSumSqDev( ZoneNum ) += Delta * ( RelLoadDiff - LoadZoneRptMean( ZoneNum ) );
 
 				if ( ReportDetailedWarmupConvergence ) { // only do this detailed thing when requested by user is on
 					// Write Warmup Convergence Information to the initialization output file
@@ -4945,7 +5922,6 @@ namespace HeatBalanceManager {
 		Real64 StdDevZoneTemp;
 		Real64 StdDevZoneLoad;
 		std::string EnvHeader;
-		int Num; // loop control
 
 		// Formats
 		static gio::Fmt Format_730( "('! <Warmup Convergence Information>,Zone Name,Environment Type/Name,','Average Warmup Temperature Difference {deltaC},','Std Dev Warmup Temperature Difference {deltaC},Max Temperature Pass/Fail Convergence,','Min Temperature Pass/Fail Convergence,Average Warmup Load Difference {W},Std Dev Warmup Load Difference {W},','Heating Load Pass/Fail Convergence,Cooling Load Pass/Fail Convergence')" );
@@ -4958,9 +5934,6 @@ namespace HeatBalanceManager {
 				FirstWarmupWrite = false;
 			}
 
-			TempZoneRptStdDev = 0.0;
-			LoadZoneRptStdDev = 0.0;
-
 			if ( RunPeriodEnvironment ) {
 				EnvHeader = "RunPeriod:";
 			} else {
@@ -4968,23 +5941,11 @@ namespace HeatBalanceManager {
 			}
 
 			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-				AverageZoneTemp = sum( TempZoneRpt( {1,CountWarmupDayPoints}, ZoneNum ) ) / double( CountWarmupDayPoints );
-				for ( Num = 1; Num <= CountWarmupDayPoints; ++Num ) {
-					if ( MaxLoadZoneRpt( Num, ZoneNum ) > 1.e-4 ) {
-						LoadZoneRpt( Num, ZoneNum ) /= MaxLoadZoneRpt( Num, ZoneNum );
-					} else {
-						LoadZoneRpt( Num, ZoneNum ) = 0.0;
-					}
-				}
-				AverageZoneLoad = sum( LoadZoneRpt( {1,CountWarmupDayPoints}, ZoneNum ) ) / double( CountWarmupDayPoints );
-				StdDevZoneTemp = 0.0;
-				StdDevZoneLoad = 0.0;
-				for ( Num = 1; Num <= CountWarmupDayPoints; ++Num ) {
-					TempZoneRptStdDev( Num ) = pow_2( TempZoneRpt( Num, ZoneNum ) - AverageZoneTemp );
-					LoadZoneRptStdDev( Num ) = pow_2( LoadZoneRpt( Num, ZoneNum ) - AverageZoneLoad );
-				}
-				StdDevZoneTemp = std::sqrt( sum( TempZoneRptStdDev( {1,CountWarmupDayPoints} ) ) / double( CountWarmupDayPoints ) );
-				StdDevZoneLoad = std::sqrt( sum( LoadZoneRptStdDev( {1,CountWarmupDayPoints} ) ) / double( CountWarmupDayPoints ) );
+				// Means and population standard deviations from the accumulators kept by RecKeepHeatBalance
+				AverageZoneTemp = TempZoneRptMean( ZoneNum );
+				AverageZoneLoad = LoadZoneRptMean( ZoneNum );
+				StdDevZoneTemp = std::sqrt( TempZoneRptSumSqDev( ZoneNum ) / double( CountWarmupDayPoints ) );
+				StdDevZoneLoad = std::sqrt( LoadZoneRptSumSqDev( ZoneNum ) / double( CountWarmupDayPoints ) );
 
 				gio::write( OutputFileInits, Format_731 ) << Zone( ZoneNum ).Name << EnvHeader + ' ' + EnvironmentName << RoundSigDigits( AverageZoneTemp, 10 ) << RoundSigDigits( StdDevZoneTemp, 10 ) << PassFail( WarmupConvergenceValues( ZoneNum ).PassFlag( 1 ) ) << PassFail( WarmupConvergenceValues( ZoneNum ).PassFlag( 2 ) ) << RoundSigDigits( AverageZoneLoad, 10 ) << RoundSigDigits( StdDevZoneLoad, 10 ) << PassFail( WarmupConvergenceValues( ZoneNum ).PassFlag( 3 ) ) << PassFail( WarmupConvergenceValues( ZoneNum ).PassFlag( 4 ) );
 			}
@@ -5276,7 +6237,6 @@ namespace HeatBalanceManager {
 		// na
 
 		// Using/Aliasing
-		using InputProcessor::MakeUPPERCase;
 		using namespace DataStringGlobals;
 		using General::POLYF; // POLYF       ! Polynomial in cosine of angle of incidence
 		using General::TrimSigDigits;
@@ -5299,12 +6259,10 @@ namespace HeatBalanceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int W5DataFileNum;
+		std::size_t W5LineIndex; // Index in the data file lines of the next line to read
 		int FileLineCount; // counter for number of lines read (used in some error messages)
 		FArray1D_string DataLine( 100 ); // Array of data lines
 		std::string NextLine; // Line of data
-		std::string WindowNameInW5DataFile;
-		std::string W5Name;
 		FArray1D_string GasName( 3 ); // Gas name from data file
 		std::string LayerName; // Layer name from data file
 		std::string MullionOrientation; // Horizontal, vertical or none
@@ -5395,9 +6353,11 @@ namespace HeatBalanceManager {
 			ShowFatalError( "Program terminates due to these conditions." );
 		}
 
-		W5DataFileNum = GetNewUnitNumber();
-		{ IOFlags flags; flags.ACTION( "read" ); gio::open( W5DataFileNum, TempFullFileName, flags ); if ( flags.err() ) goto Label999; }
-		gio::read( W5DataFileNum, fmtA ) >> NextLine;
+		// The data file is read and indexed by window name once; later constructions from the same file
+		// go straight to their entry
+		auto const & W5File( GetWindow5DataFileIndex( TempFullFileName, exists ) );
+		if ( ! exists ) goto Label999;
+		NextLine = W5File.Lines.empty() ? std::string() : W5File.Lines.front();
 		endcol = len( NextLine );
 		if ( endcol > 0 ) {
 			if ( int( NextLine[ endcol - 1 ] ) == iUnicode_end ) {
@@ -5407,10 +6367,10 @@ namespace HeatBalanceManager {
 			}
 		}
 
-		gio::rewind( W5DataFileNum );
+		W5LineIndex = 0;
 		FileLineCount = 0;
 
-		{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+		ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 		if ( ReadStat < GoodIOStatValue ) goto Label1000;
 		++FileLineCount;
 		if ( ! has_prefixi( NextLine, "WINDOW5" ) ) {
@@ -5418,44 +6378,36 @@ namespace HeatBalanceManager {
 			ShowFatalError( "Error reading Window5 Data File: first word of window entry is \"" + NextLine.substr( 0, 7 ) + "\", should be Window5." );
 		}
 
-Label10: ;
+		// Go to the entry of the desired window
+		{ auto const Entry( W5File.EntryLine.find( DesiredConstructionName ) );
+		if ( Entry == W5File.EntryLine.end() ) goto Label1000;
+		W5LineIndex = Entry->second + 1;
+		FileLineCount = int( W5LineIndex ); }
 		for ( LineNum = 2; LineNum <= 5; ++LineNum ) {
-			{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> DataLine( LineNum ); ReadStat = flags.ios(); }
+			ReadWindow5DataLine( W5File, W5LineIndex, DataLine( LineNum ), ReadStat );
 			if ( ReadStat < GoodIOStatValue ) goto Label1000;
 			++FileLineCount;
 		}
 
-		// Get window name and check for match
-		gio::read( DataLine( 4 ).substr( 19 ), fmtA ) >> W5Name;
-		WindowNameInW5DataFile = MakeUPPERCase( W5Name );
-		if ( DesiredConstructionName != WindowNameInW5DataFile ) {
-			// Doesn't match; read through file until next window entry is found
-Label20: ;
-			{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
-			if ( ReadStat < GoodIOStatValue ) goto Label1000;
-			++FileLineCount;
-			if ( ! has_prefixi( NextLine, "WINDOW5" ) ) goto Label20;
-			// Beginning of next window entry found
-			goto Label10;
-		} else {
+		{
 			// Match found
 			ConstructionFound = true;
 
 			// Create Material:WindowGlass, Material:WindowGas, Construction
 			// and WindowFrameAndDividerObjects for this window
 
-			{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+			ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 			if ( ReadStat < GoodIOStatValue ) goto Label1000;
 			++FileLineCount;
 			gio::read( NextLine.substr( 19 ), "*" ) >> NGlSys;
 			if ( NGlSys <= 0 || NGlSys > 2 ) {
 				ShowFatalError( "Construction=" + DesiredConstructionName + " from the Window5 data file cannot be used: it has " + TrimSigDigits( NGlSys ) + " glazing systems; only 1 or 2 are allowed." );
 			}
-			{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+			ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 			if ( ReadStat < GoodIOStatValue ) goto Label1000;
 			++FileLineCount;
 			for ( IGlSys = 1; IGlSys <= NGlSys; ++IGlSys ) {
-				{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+				ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 				if ( ReadStat < GoodIOStatValue ) goto Label1000;
 				++FileLineCount;
 				{ IOFlags flags; gio::read( NextLine.substr( 19 ), "*", flags ) >> WinHeight( IGlSys ) >> WinWidth( IGlSys ) >> NGlass( IGlSys ) >> UValCenter( IGlSys ) >> SCCenter( IGlSys ) >> SHGCCenter( IGlSys ) >> TVisCenter( IGlSys ); ReadStat = flags.ios(); }
@@ -5488,7 +6440,7 @@ Label20: ;
 				WinWidth( IGlSys ) *= 0.001;
 			}
 			for ( LineNum = 1; LineNum <= 11; ++LineNum ) {
-				{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> DataLine( LineNum ); ReadStat = flags.ios(); }
+				ReadWindow5DataLine( W5File, W5LineIndex, DataLine( LineNum ), ReadStat );
 				if ( ReadStat == -1 ) goto Label1000;
 			}
 
@@ -5552,13 +6504,13 @@ Label20: ;
 			FrameProjectionIn *= 0.001;
 			FileLineCount += 11;
 
-			{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+			ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 			if ( ReadStat < GoodIOStatValue ) goto Label1000;
 			++FileLineCount;
 
 			// Divider data for each glazing system
 			for ( IGlSys = 1; IGlSys <= NGlSys; ++IGlSys ) {
-				{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+				ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 				if ( ReadStat < GoodIOStatValue ) goto Label1000;
 				++FileLineCount;
 				{ IOFlags flags; gio::read( NextLine.substr( 19 ), "*", flags ) >> DividerWidth( IGlSys ) >> DividerProjectionOut( IGlSys ) >> DividerProjectionIn( IGlSys ) >> DividerConductance( IGlSys ) >> DivEdgeToCenterGlCondRatio( IGlSys ) >> DividerSolAbsorp( IGlSys ) >> DividerVisAbsorp( IGlSys ) >> DividerEmis( IGlSys ) >> DividerType( IGlSys ) >> HorDividers( IGlSys ) >> VertDividers( IGlSys ); ReadStat = flags.ios(); }
@@ -5685,7 +6637,7 @@ Label20: ;
 			}
 
 			// Glass objects
-			{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+			ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 			if ( ReadStat < GoodIOStatValue ) goto Label1000;
 			++FileLineCount;
 			MaterNum = TotMaterialsPrev;
@@ -5694,7 +6646,7 @@ Label20: ;
 					++MaterNum;
 					MaterNumSysGlass( IGlSys, IGlass ) = MaterNum;
 					Material( MaterNum ).Group = WindowGlass;
-					{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+					ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 					++FileLineCount;
 					gio::read( NextLine.substr( 25 ), "*" ) >> Material( MaterNum ).Thickness >> Material( MaterNum ).Conductivity >> Material( MaterNum ).Trans >> Material( MaterNum ).ReflectSolBeamFront >> Material( MaterNum ).ReflectSolBeamBack >> Material( MaterNum ).TransVis >> Material( MaterNum ).ReflectVisBeamFront >> Material( MaterNum ).ReflectVisBeamBack >> Material( MaterNum ).TransThermal >> Material( MaterNum ).AbsorpThermalFront >> Material( MaterNum ).AbsorpThermalBack >> LayerName;
 					Material( MaterNum ).Thickness *= 0.001;
@@ -5717,14 +6669,14 @@ Label20: ;
 			}
 
 			// Gap objects
-			{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+			ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 			if ( ReadStat < GoodIOStatValue ) goto Label1000;
 			++FileLineCount;
 			for ( IGlSys = 1; IGlSys <= NGlSys; ++IGlSys ) {
 				for ( IGap = 1; IGap <= NGaps( IGlSys ); ++IGap ) {
 					++MaterNum;
 					MaterNumSysGap( IGlSys, IGap ) = MaterNum;
-					{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+					ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 					++FileLineCount;
 					gio::read( NextLine.substr( 23 ), "*" ) >> Material( MaterNum ).Thickness >> NumGases( IGlSys, IGap );
 					if ( NGlSys == 1 ) {
@@ -5737,7 +6689,7 @@ Label20: ;
 				}
 			}
 
-			{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+			ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 			if ( ReadStat < GoodIOStatValue ) goto Label1000;
 			++FileLineCount;
 			for ( IGlSys = 1; IGlSys <= NGlSys; ++IGlSys ) {
@@ -5747,7 +6699,7 @@ Label20: ;
 					Material( MaterNum ).Group = WindowGas;
 					if ( NumGases( IGlSys, IGap ) > 1 ) Material( MaterNum ).Group = WindowGasMixture;
 					for ( IGas = 1; IGas <= NumGases( IGlSys, IGap ); ++IGas ) {
-						{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+						ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 						++FileLineCount;
 						gio::read( NextLine.substr( 19 ), "*" ) >> GasName( IGas ) >> Material( MaterNum ).GasFract( IGas ) >> Material( MaterNum ).GasWght( IGas ) >> Material( MaterNum ).GasCon( IGas, _ ) >> Material( MaterNum ).GasVis( IGas, _ ) >> Material( MaterNum ).GasCp( IGas, _ );
 						// Nominal resistance of gap at room temperature (based on first gas in mixture)
@@ -5764,7 +6716,7 @@ Label20: ;
 			NominalRforNominalUCalculation.redimension( TotConstructs );
 			NominalU.redimension( TotConstructs );
 
-			{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+			ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 			if ( ReadStat < GoodIOStatValue ) goto Label1000;
 			++FileLineCount;
 
@@ -5853,15 +6805,15 @@ Label20: ;
 					CosPhiIndepVar( IPhi ) = std::cos( ( IPhi - 1 ) * 10.0 * DegToRadians );
 				}
 
-				{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+				ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 				if ( ReadStat < GoodIOStatValue ) goto Label1000;
 				++FileLineCount;
 				if ( IGlSys == 1 ) {
-					{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+					ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 					if ( ReadStat < GoodIOStatValue ) goto Label1000;
 					++FileLineCount;
 				}
-				{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+				ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 				if ( ReadStat < GoodIOStatValue ) goto Label1000;
 				++FileLineCount;
 				{ IOFlags flags; gio::read( NextLine.substr( 5 ), "*", flags ) >> Tsol; ReadStat = flags.ios(); }
@@ -5875,7 +6827,7 @@ Label20: ;
 					ErrorsFound = true;
 				}
 				for ( IGlass = 1; IGlass <= NGlass( IGlSys ); ++IGlass ) {
-					{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> NextLine; ReadStat = flags.ios(); }
+					ReadWindow5DataLine( W5File, W5LineIndex, NextLine, ReadStat );
 					++FileLineCount;
 					{ IOFlags flags; gio::read( NextLine.substr( 5 ), "*", flags ) >> AbsSol( IGlass, _ ); ReadStat = flags.ios(); }
 					if ( ReadStat != 0 ) {
@@ -5889,7 +6841,7 @@ Label20: ;
 					}
 				}
 				for ( ILine = 1; ILine <= 5; ++ILine ) {
-					{ IOFlags flags; gio::read( W5DataFileNum, fmtA, flags ) >> DataLine( ILine ); ReadStat = flags.ios(); }
+					ReadWindow5DataLine( W5File, W5LineIndex, DataLine( ILine ), ReadStat );
 				}
 				{ IOFlags flags; gio::read( DataLine( 1 ).substr( 5 ), "*", flags ) >> Rfsol; ReadStat = flags.ios(); }
 				if ( ReadStat != 0 ) {
@@ -6056,7 +7008,6 @@ Label20: ;
 
 		}
 
-		gio::close( W5DataFileNum );
 		return;
 
 Label999: ;
@@ -6065,7 +7016,99 @@ Label999: ;
 
 Label1000: ;
 		EOFonFile = true;
-		gio::close( W5DataFileNum );
+
+	}
+
+	Window5DataFileIndex const &
+	GetWindow5DataFileIndex(
+		std::string const & FullFileName, // Full path of the Window5 data file
+		bool & FileRead // True if the file could be read
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the lines of a Window5 data file together with an index from each window name
+		// on the file to the line starting its entry.
+
+		// METHODOLOGY EMPLOYED:
+		// The file is read into memory the first time it is requested and kept in Window5DataFiles.
+		// Window names are taken from the fourth line of each entry exactly as SearchWindow5DataFile
+		// used to read them while scanning the file; if a name occurs more than once the first entry
+		// is used, as the scan did.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::MakeUPPERCase;
+
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::string W5Name; // Window name from the data file
+
+		FileRead = true;
+		auto const Found( Window5DataFiles.find( FullFileName ) );
+		if ( Found != Window5DataFiles.end() ) return Found->second;
+
+		std::ifstream W5DataFile( FullFileName, std::ios_base::in | std::ios_base::binary );
+		if ( ! W5DataFile ) {
+			FileRead = false;
+			static Window5DataFileIndex const NoFile;
+			return NoFile;
+		}
+
+		Window5DataFileIndex & W5File( Window5DataFiles[ FullFileName ] );
+		std::string Line;
+		while ( std::getline( W5DataFile, Line ) ) {
+			if ( ! Line.empty() && Line.back() == '\r' ) Line.pop_back();
+			W5File.Lines.push_back( Line );
+		}
+
+		for ( std::size_t LineIndex = 0, NumLines = W5File.Lines.size(); LineIndex + 3 < NumLines; ++LineIndex ) {
+			if ( ! has_prefixi( W5File.Lines[ LineIndex ], "WINDOW5" ) ) continue;
+			std::string const & NameLine( W5File.Lines[ LineIndex + 3 ] );
+			if ( NameLine.length() < 19 ) continue;
+			gio::read( NameLine.substr( 19 ), fmtA ) >> W5Name;
+			W5File.EntryLine.emplace( MakeUPPERCase( W5Name ), LineIndex );
+		}
+
+		return W5File;
+
+	}
+
+	void
+	ReadWindow5DataLine(
+		Window5DataFileIndex const & W5File, // Window5 data file
+		std::size_t & LineIndex, // Index in W5File.Lines of the next line to read
+		std::string & Line, // Line read
+		int & ReadStat // Read status: 0 if a line was read, -1 at end of file
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the next line of a Window5 data file held in memory, with the same status
+		// values as a formatted read of the file.
+
+		if ( LineIndex < W5File.Lines.size() ) {
+			Line = W5File.Lines[ LineIndex ];
+			++LineIndex;
+			ReadStat = 0;
+		} else {
+			Line.clear();
+			ReadStat = -1;
+		}
 
 	}
 
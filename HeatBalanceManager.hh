@@ -1,6 +1,12 @@
 #ifndef HeatBalanceManager_hh_INCLUDED
 #define HeatBalanceManager_hh_INCLUDED
 
+// C++ Headers
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray2D.hh>
@@ -42,11 +48,10 @@ namespace HeatBalanceManager {
 	extern FArray1D< Real64 > TempZone; // Zone air temperature from the current warmup day
 	extern FArray1D< Real64 > LoadZone; // Zone load from the current warmup day
 
-	extern FArray2D< Real64 > TempZoneRpt; // Zone air temperature to report (average over all warmup days)
-	extern FArray1D< Real64 > TempZoneRptStdDev; // Zone air temperature to report (std dev over all warmup days)
-	extern FArray2D< Real64 > LoadZoneRpt; // Zone load to report (average over all warmup days)
-	extern FArray1D< Real64 > LoadZoneRptStdDev; // Zone load to report (std dev over all warmup days)
-	extern FArray2D< Real64 > MaxLoadZoneRpt; // Maximum zone load for reporting calcs
+	extern FArray1D< Real64 > TempZoneRptMean; // Running mean of the warmup temperature difference of each zone
+	extern FArray1D< Real64 > TempZoneRptSumSqDev; // Running sum of squared deviations from that mean
+	extern FArray1D< Real64 > LoadZoneRptMean; // Running mean of the relative warmup load difference of each zone
+	extern FArray1D< Real64 > LoadZoneRptSumSqDev; // Running sum of squared deviations from that mean
 	extern int CountWarmupDayPoints; // Count of warmup timesteps (to achieve warmup)
 
 	extern std::string CurrentModuleObject; // to assist in getting input
@@ -104,8 +109,21 @@ namespace HeatBalanceManager {
 
 	};
 
+	struct Window5DataFileIndex
+	{
+		// Members
+		std::vector< std::string > Lines; // Lines of the Window5 data file
+		std::unordered_map< std::string, std::size_t > EntryLine; // Uppercase window name -> Lines index of its "Window5" line
+
+		// Default Constructor
+		Window5DataFileIndex()
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< WarmupConvergence > WarmupConvergenceValues;
+	extern std::unordered_map< std::string, Window5DataFileIndex > Window5DataFiles; // Window5 data files read so far, by full file name
 
 	// Functions
 
@@ -133,6 +151,18 @@ namespace HeatBalanceManager {
 	void
 	GetSiteAtmosphereData( bool & ErrorsFound );
 
+	void
+	GetPerformancePrecisionTradeoffs( bool & ErrorsFound ); // Set to true if errors detected during getting data
+
+	void
+	GetSurfaceHeatBalanceCapture( bool & ErrorsFound ); // Set to true if errors detected during getting data
+
+	void
+	GetTimeDecomposition( bool & ErrorsFound ); // Set to true if errors detected during getting data
+
+	void
+	GetHeatBalanceScaling( bool & ErrorsFound ); // Set to true if errors detected during getting data
+
 	void
 	GetMaterialData( bool & ErrorsFound ); // set to true if errors found in input
 
@@ -149,6 +179,37 @@ namespace HeatBalanceManager {
 	void
 	GetConstructData( bool & ErrorsFound ); // If errors found in input
 
+	void
+	GetParametricBatch( bool & ErrorsFound ); // If errors found in input
+
+	void
+	RunParametricBatch();
+
+	void
+	WaitForParametricVariant();
+
+	void
+	StartParametricVariant( int const VariantNum ); // Variant simulated by this (child) process
+
+	bool
+	RedirectParametricVariantFiles( std::string const & Directory ); // Directory of the variant, relative to the run directory
+
+	int
+	CheckMaterialOverride(
+		std::string const & MaterialName, // Name of the Material or Material:RoofVegetation to change
+		std::string const & FieldName, // IDD field name of the property to change
+		Real64 const Value, // New value of the property
+		bool & ErrorsFound // Set to true if the override cannot be applied
+	);
+
+	void
+	ApplyMaterialOverride(
+		std::string const & MaterialName, // Name of the Material or Material:RoofVegetation to change
+		std::string const & FieldName, // IDD field name of the property to change
+		Real64 const Value, // New value of the property
+		bool & ErrorsFound // Set to true if the override cannot be applied
+	);
+
 	void
 	GetBuildingData( bool & ErrorsFound ); // If errors found in input
 
@@ -219,6 +280,20 @@ namespace HeatBalanceManager {
 		bool & ErrorsFound // True if there is a problem with the entry requested from the data file
 	);
 
+	Window5DataFileIndex const &
+	GetWindow5DataFileIndex(
+		std::string const & FullFileName, // Full path of the Window5 data file
+		bool & FileRead // True if the file could be read
+	);
+
+	void
+	ReadWindow5DataLine(
+		Window5DataFileIndex const & W5File, // Window5 data file
+		std::size_t & LineIndex, // Index in W5File.Lines of the next line to read
+		std::string & Line, // Line read
+		int & ReadStat // Read status: 0 if a line was read, -1 at end of file
+	);
+
 	void
 	SetStormWindowControl();
 
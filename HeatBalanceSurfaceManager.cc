@@ -1,6 +1,20 @@
 // C++ Headers
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+#ifdef EP_HeatBalancePerfCounters
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -127,12 +141,136 @@ namespace HeatBalanceSurfaceManager {
 	// Data
 	// MODULE PARAMETER DEFINITIONS:
 	static std::string const BlankString;
+	int const PhaseInitSurfaceHeatBalance( 1 );
+	int const PhaseOutsideSurf( 2 );
+	int const PhaseInsideSurf( 3 );
+	int const PhaseThermalHistories( 4 );
+	int const PhaseGreenRoof( 5 );
+	int const NumHeatBalancePhases( 5 );
+	FArray1D_string const HeatBalancePhaseNames( NumHeatBalancePhases, { "InitSurfaceHeatBalance", "CalcHeatBalanceOutsideSurf", "CalcHeatBalanceInsideSurf", "UpdateThermalHistories", "Green Roof" } );
+	int const CounterCycles( 1 );
+	int const CounterInstructions( 2 );
+	int const CounterL1DMisses( 3 );
+	int const CounterLLCMisses( 4 );
+	int const CounterBranchMisses( 5 );
+	int const NumPhaseCounters( 5 );
+	int const HeatBalanceChunkSize( 64 );
+	std::string const HeatBalanceCheckpointMagic( "EPHBCKPT" );
+	int const HeatBalanceCheckpointVersion( 3 );
+	int const HeatBalanceCheckpointNumArrays( 35 );
+	int const HeatBalanceCheckpointNumScalars( 18 );
+	std::string const SurfaceHeatBalanceCaptureMagic( "EPHBCAPT" );
 
 	// DERIVED TYPE DEFINITIONS:
 	// na
 
 	// MODULE VARIABLE DECLARATIONS:
-	// na
+	FArray1D_int ExtVentCavIterations; // Baffle/cavity solution iterations of each exterior vented cavity (last solve)
+	FArray1D_bool ExtVentCavSolved; // True once an exterior vented cavity has been solved in the current outside pass
+
+	// Compact copies of the SurfaceData fields read by the surface heat balance loops;
+	// set by InitSurfaceHotFields, with SurfConstruction kept current by InitEMSControlledConstructions
+	FArray1D_int SurfZone; // Surface( SurfNum ).Zone
+	FArray1D_int SurfClass; // Surface( SurfNum ).Class
+	FArray1D_bool SurfHeatTransSurf; // Surface( SurfNum ).HeatTransSurf
+	FArray1D_int SurfHeatTransferAlgorithm; // Surface( SurfNum ).HeatTransferAlgorithm
+	FArray1D_int SurfExtBoundCond; // Surface( SurfNum ).ExtBoundCond
+	FArray1D_int SurfConstruction; // Surface( SurfNum ).Construction
+	FArray1D< Real64 > SurfArea; // Surface( SurfNum ).Area
+	FArray1D_bool SurfExtEcoRoof; // Surface( SurfNum ).ExtEcoRoof
+	FArray1D_int SurfOSCMPtr; // Surface( SurfNum ).OSCMPtr
+	int NumCondFDSurf( 0 ); // Number of surfaces in CondFDSurf
+	FArray1D_int CondFDSurf; // Heat transfer surfaces using the finite difference (CondFD) algorithm
+	int NumWindowSurf( 0 ); // Number of surfaces in WindowSurf
+	FArray1D_int WindowSurf; // Window and TDD dome surfaces, the only ones whose SurfaceWindow terms are set
+	bool SunDownSolarZeroed( false ); // Solar quantities set only while the sun is up were zeroed at a sun-down timestep
+	FArray1D< BlindSlatAngProperties > SurfWinBlindProps; // Blind properties of each window at its current slat angle
+
+	// Inputs of ComputeIntThermalAbsorpFactors when each surface's zone was last evaluated
+	FArray1D_bool IntThermalAbsorpZoneDirty; // ITABSF and TMULT of the zone must be re-evaluated
+	FArray1D_int IntThermalAbsorpConstr; // Surface( SurfNum ).Construction
+	FArray1D_int IntThermalAbsorpShadeFlag; // SurfaceWindow( SurfNum ).ShadingFlag
+	FArray1D_int IntThermalAbsorpConstrSh; // SurfaceWindow( SurfNum ).ShadedConstruction
+	FArray1D_int IntThermalAbsorpBlindNum; // SurfaceWindow( SurfNum ).BlindNumber
+	FArray1D< Real64 > IntThermalAbsorpSlatAng; // SurfaceWindow( SurfNum ).SlatAngThisTS [rad]
+	FArray1D< Real64 > IntThermalAbsorpSwitchFac; // SurfaceWindow( SurfNum ).SwitchingFactor
+	FArray1D_bool IntThermalAbsorpMovInsul; // True if exterior movable insulation is present
+
+	// Zero-term CTF coefficients of each surface's construction, refreshed each timestep by InitSurfaceCTFZeroTerms
+	FArray1D< Real64 > SurfCTFOutside0; // Construct( SurfConstruction ).CTFOutside( 0 )
+	FArray1D< Real64 > SurfCTFInside0; // Construct( SurfConstruction ).CTFInside( 0 )
+	FArray1D< Real64 > SurfCTFCross0; // Construct( SurfConstruction ).CTFCross( 0 )
+	FArray1D< Real64 > SurfCTFSourceOut0; // Construct( SurfConstruction ).CTFSourceOut( 0 )
+	FArray1D< Real64 > SurfCTFSourceIn0; // Construct( SurfConstruction ).CTFSourceIn( 0 )
+
+	// Linearized conduction at the outside face of exterior CTF surfaces, set each outside heat balance
+	// pass by CalcCTFOutFaceCoupling: conduction from the outside face into the construction is
+	// CTFOutFaceCondCoef * TH(SurfNum,1,1) - CTFOutFaceCondConst
+	FArray1D< Real64 > CTFOutFaceCondConst; // Part independent of the outside face temperature [W/m2]
+	FArray1D< Real64 > CTFOutFaceCondCoef; // Coefficient of the outside face temperature [W/m2-K]
+
+	// Exterior CTF surfaces without movable insulation, other side conditions model or internal source
+	// whose outside face temperature is evaluated after the surface loop by CalcOutsideSurfTempBatch
+	int NumOutsideBatch( 0 ); // Number of surfaces in OutsideBatchSurf
+	FArray1D_int OutsideBatchSurf; // Surface numbers of the deferred surfaces
+	FArray1D< Real64 > OutsideBatchTempExt; // Exterior temperature boundary condition of a deferred surface
+
+	// Master history interpolation state of UpdateThermalHistories
+	FArray1D< Real64 > QExt1; // Heat flux at the exterior surface during first time step/series
+	FArray1D< Real64 > QInt1; // Heat flux at the interior surface during first time step/series
+	FArray1D< Real64 > TempInt1; // Temperature of interior surface during first time step/series
+	FArray1D< Real64 > TempExt1; // Temperature of exterior surface during first time step/series
+	FArray1D< Real64 > Qsrc1; // Heat source/sink (during first time step/series)
+	FArray1D< Real64 > Tsrc1; // Temperature at source/sink (during first time step/series)
+	FArray1D< Real64 > SumTime; // Amount of time that has elapsed from start of master history to the current time step
+
+	// Iteration state of CalcHeatBalanceInsideSurf
+	FArray1D< Real64 > TempInsOld; // Holds previous iteration's value for convergence check
+	FArray1D< Real64 > RefAirTemp; // reference air temperatures
+
+	// Inside face temperature predictor (InsideSurfTempPredictor) and iteration statistics
+	FArray2D< Real64 > TempSurfInHist; // Converged TempSurfIn of the last three zone timesteps (surface, 1 = latest)
+	int NumTempSurfInHist( 0 ); // Number of valid timesteps held in TempSurfInHist
+	bool TempSurfInPredictPending( false ); // True until the first full inside heat balance of the timestep
+	FArray1D_bool TempSurfInPredicted; // True if the surface started the timestep from an extrapolated temperature
+	int InsideSurfPredictorFallbacks( 0 ); // Surfaces restarted from their last converged temperature this timestep
+	Real64 InsideSurfIterSum( 0.0 ); // Iterations of the full inside heat balances of this environment (no warmup)
+	int InsideSurfSolveCount( 0 ); // Number of full inside heat balances counted in InsideSurfIterSum
+	int InsideSurfFallbackSum( 0 ); // Predictor fallbacks counted over the same heat balances
+
+	// Change-driven re-evaluation of the inside convection coefficients in CalcHeatBalanceInsideSurf
+	FArray1D< Real64 > HConvInEvalDelTemp; // Surface minus zone air temperature at the last HConvIn evaluation [C]
+	int HConvInEvalCount( 0 ); // Inside convection coefficients re-evaluated during this timestep's iterations
+	int HConvInSkipCount( 0 ); // Inside convection coefficient re-evaluations skipped during this timestep
+
+	// Phase timing of the surface heat balance, reported and reset at the end of each environment
+	FArray1D< Real64 > HeatBalancePhaseTime( NumHeatBalancePhases, 0.0 ); // Time spent in each phase [s]
+	FArray1D_int HeatBalancePhaseCalls( NumHeatBalancePhases, 0 ); // Number of times each phase was entered
+	int HeatBalancePhaseSteps( 0 ); // Calls of ManageSurfaceHeatBalance timed in this environment
+	FArray1D< std::chrono::steady_clock::time_point > HeatBalancePhaseStartTime( NumHeatBalancePhases ); // Start of the phase in progress
+	bool HeatBalancePhaseCountersActive( false ); // True if the hardware counters could be opened
+	FArray2D< Real64 > HeatBalancePhaseCounters( NumPhaseCounters, NumHeatBalancePhases, 0.0 ); // Counts accumulated in each phase (counter, phase)
+	FArray2D< Real64 > HeatBalancePhaseCounterStart( NumPhaseCounters, NumHeatBalancePhases, 0.0 ); // Counts at the start of the phase in progress
+	FArray1D< Real64 > PhaseCounterValues( NumPhaseCounters, 0.0 ); // Scratch read buffer of StartHeatBalancePhase/EndHeatBalancePhase
+#ifdef EP_HeatBalancePerfCounters
+	FArray1D_int PerfCounterFd( NumPhaseCounters, -1 ); // perf_event file descriptors; the first leads the group
+#endif
+
+	// Threads used by the parallel surface and zone loops (InitHeatBalanceThreads)
+	int HeatBalanceThreads( 1 );
+
+	// Surface heat balance capture and replay (Output:SurfaceHeatBalanceCapture)
+	SurfaceHeatBalanceCapture SurfaceCapture; // Capture being taken or replayed
+	bool SurfaceCaptureDone( false ); // True once the capture was written or replayed
+
+	// Trace-event timeline of the heat balance (InitHeatBalanceTrace)
+	bool HeatBalanceTraceActive( false ); // True if trace events are being written
+	int HeatBalanceTraceEveryN( 1 ); // Keep every Nth zone timestep (0 = none by count)
+	Real64 HeatBalanceTraceMinDuration( 0.0 ); // Also keep zone timesteps at least this long (0 = off) [us]
+	int HeatBalanceTraceStepCount( 0 ); // Zone timesteps traced so far
+	std::chrono::steady_clock::time_point HeatBalanceTraceOrigin; // Time zero of the trace
+	std::string HeatBalanceTraceStepEvents; // Events of the zone timestep in progress, kept or dropped at its end
+	std::ofstream HeatBalanceTraceFile; // Trace-event JSON file
 
 	// Subroutine Specifications for the Heat Balance Module
 	// Driver Routines
@@ -195,19 +333,30 @@ namespace HeatBalanceSurfaceManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// na
 		static bool firstTime( true );
-		int SurfNum;
-		int ConstrNum;
 
 		// FLOW:
-		if ( firstTime ) DisplayString( "Initializing Surfaces" );
+		if ( firstTime ) {
+			DisplayString( "Initializing Surfaces" );
+			InitHeatBalanceThreads();
+			InitHeatBalancePhaseCounters();
+		}
+		++HeatBalancePhaseSteps;
+		StartHeatBalancePhase( PhaseInitSurfaceHeatBalance );
 		InitSurfaceHeatBalance(); // Initialize all heat balance related parameters
+		EndHeatBalancePhase( PhaseInitSurfaceHeatBalance );
 
 		// Solve the zone heat balance 'Detailed' solution
 		// Call the outside and inside surface heat balances
+		if ( SurfaceCaptureMode != SurfaceCaptureNone && IsSurfaceHeatBalanceCaptureStep() ) StartSurfaceHeatBalanceCapture();
 		if ( firstTime ) DisplayString( "Calculate Outside Surface Heat Balance" );
+		StartHeatBalancePhase( PhaseOutsideSurf );
 		CalcHeatBalanceOutsideSurf();
+		EndHeatBalancePhase( PhaseOutsideSurf );
 		if ( firstTime ) DisplayString( "Calculate Inside Surface Heat Balance" );
+		StartHeatBalancePhase( PhaseInsideSurf );
 		CalcHeatBalanceInsideSurf();
+		EndHeatBalancePhase( PhaseInsideSurf );
+		if ( SurfaceCaptureMode == SurfaceCaptureWrite && IsSurfaceHeatBalanceCaptureStep() ) FinishSurfaceHeatBalanceCapture();
 
 		// The air heat balance must be called before the temperature history
 		// updates because there may be a radiant system in the building
@@ -221,23 +370,30 @@ namespace HeatBalanceSurfaceManager {
 
 		// Before we leave the Surface Manager the thermal histories need to be updated
 		if ( ( any_eq( HeatTransferAlgosUsed, UseCTF ) ) || ( any_eq( HeatTransferAlgosUsed, UseEMPD ) ) ) {
+			StartHeatBalancePhase( PhaseThermalHistories );
 			UpdateThermalHistories(); //Update the thermal histories
+			EndHeatBalancePhase( PhaseThermalHistories );
+			if ( InsideSurfTempPredictor != InsideSurfTempPredictorNone ) UpdateInsideSurfTempHistory();
 		}
 
 		if ( any_eq( HeatTransferAlgosUsed, UseCondFD ) ) {
-			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-				if ( Surface( SurfNum ).Construction <= 0 ) continue; // Shading surface, not really a heat transfer surface
-				ConstrNum = Surface( SurfNum ).Construction;
-				if ( Construct( ConstrNum ).TypeIsWindow ) continue; //  Windows simulated in Window module
-				if ( Surface( SurfNum ).HeatTransferAlgorithm != HeatTransferModel_CondFD ) continue;
+			// Each surface updates only its own node histories: run on HeatBalanceThreads threads
+			HeatBalanceParallelFor( 1, NumCondFDSurf, [&]( int const Item ) {
+				int const SurfNum( CondFDSurf( Item ) );
+				if ( Construct( SurfConstruction( SurfNum ) ).TypeIsWindow ) return; //  Windows simulated in Window module
 				SurfaceFD( SurfNum ).UpdateMoistureBalance();
-			}
+			} );
 		}
 
 		ManageThermalComfort( false ); // "Record keeping" for the zone
 
 		ReportSurfaceHeatBalance();
 		if ( ZoneSizingCalc ) GatherComponentLoadsSurface();
+		if ( EndEnvrnFlag ) {
+			if ( ! HeatBalanceScalingFileName.empty() ) ReportHeatBalanceScaling();
+			ReportInsideSurfIterations();
+			ReportHeatBalancePhases();
+		}
 
 		firstTime = false;
 
@@ -382,6 +538,7 @@ namespace HeatBalanceSurfaceManager {
 		// Do the Begin Simulation initializations
 		if ( BeginSimFlag ) {
 			AllocateSurfaceHeatBalArrays(); // Allocate the Module Arrays before any inits take place
+			InitSurfaceHotFields();
 			InterZoneWindow = any( Zone.HasInterZoneWindow() );
 			IsZoneDV.dimension( NumOfZones, false );
 			IsZoneCV.dimension( NumOfZones, false );
@@ -402,6 +559,7 @@ namespace HeatBalanceSurfaceManager {
 			InitEMSControlledSurfaceProperties();
 
 		}
+		InitSurfaceCTFZeroTerms();
 
 		// Need to be called each timestep in order to check if surface points to new construction (EMS) and if does then
 		// complex fenestration needs to be initialized for additional states
@@ -617,6 +775,12 @@ namespace HeatBalanceSurfaceManager {
 		InitIntSolarDistribution();
 		if ( firstTime ) DisplayString( "Initializing Interior Convection Coefficients" );
 		InitInteriorConvectionCoeffs( TempSurfInTmp );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Driving temperature differences of this evaluation
+			int const ZoneNum( Surface( SurfNum ).Zone );
+			if ( ZoneNum > 0 ) HConvInEvalDelTemp( SurfNum ) = TempSurfInTmp( SurfNum ) - MAT( ZoneNum );
+		}
+		HConvInEvalCount = 0;
+		HConvInSkipCount = 0;
 
 		if ( BeginSimFlag ) { // Now's the time to report surfaces, if desired
 			//    if (firstTime) CALL DisplayString('Reporting Surfaces')
@@ -1168,6 +1332,7 @@ namespace HeatBalanceSurfaceManager {
 		CTFTsrcConstPart.dimension( TotSurfaces, 0.0 );
 		TempEffBulkAir.dimension( TotSurfaces, 23.0 );
 		HConvIn.dimension( TotSurfaces, 0.0 );
+		HConvInEvalDelTemp.dimension( TotSurfaces, 0.0 );
 		HcExtSurf.dimension( TotSurfaces, 0.0 );
 		HAirExtSurf.dimension( TotSurfaces, 0.0 );
 		HSkyExtSurf.dimension( TotSurfaces, 0.0 );
@@ -1183,6 +1348,15 @@ namespace HeatBalanceSurfaceManager {
 		QRadSWOutMvIns.dimension( TotSurfaces, 0.0 );
 		QRadThermInAbs.dimension( TotSurfaces, 0.0 );
 		SUMH.dimension( TotSurfaces, 0 );
+		QExt1.dimension( TotSurfaces, 0.0 );
+		QInt1.dimension( TotSurfaces, 0.0 );
+		TempInt1.dimension( TotSurfaces, 0.0 );
+		TempExt1.dimension( TotSurfaces, 0.0 );
+		SumTime.dimension( TotSurfaces, 0.0 );
+		Qsrc1.dimension( TotSurfaces, 0.0 );
+		Tsrc1.dimension( TotSurfaces, 0.0 );
+		TempInsOld.dimension( TotSurfaces, 23.0 );
+		RefAirTemp.dimension( TotSurfaces, 23.0 );
 
 		TH.dimension( TotSurfaces, MaxCTFTerms, 2, 0.0 );
 		TempSurfOut.dimension( TotSurfaces, 0.0 );
@@ -1247,6 +1421,7 @@ namespace HeatBalanceSurfaceManager {
 		OpaqSurfStorageConductionEnergy.dimension( TotSurfaces, 0.0 );
 
 		OpaqSurfInsFaceBeamSolAbsorbed.dimension( TotSurfaces, 0.0 );
+		SurfWinBlindProps.dimension( TotSurfaces );
 		TempSource.dimension( TotSurfaces, 0.0 );
 		QH.dimension( TotSurfaces, MaxCTFTerms, 2, 0.0 );
 		THM.dimension( TotSurfaces, MaxCTFTerms, 2, 0.0 );
@@ -1415,6 +1590,13 @@ namespace HeatBalanceSurfaceManager {
 			SetupOutputVariable( "Zone Mean Radiant Temperature [C]", ZoneMRT( loop ), "Zone", "State", Zone( loop ).Name );
 		}
 
+		ExtVentCavIterations.dimension( TotExtVentCav, 0 );
+		ExtVentCavSolved.dimension( TotExtVentCav, false );
+		for ( loop = 1; loop <= TotExtVentCav; ++loop ) {
+			//CurrentModuleObject='SurfaceProperty:ExteriorNaturalVentedCavity'
+			SetupOutputVariable( "Surface Exterior Vented Cavity Solution Iteration Count []", ExtVentCavIterations( loop ), "Zone", "Sum", ExtVentedCavity( loop ).Name );
+		}
+
 	}
 
 	void
@@ -1620,6 +1802,10 @@ namespace HeatBalanceSurfaceManager {
 		// METHODOLOGY EMPLOYED:
 		// If the sun is down, all of the pertinent arrays are zeroed.  If the
 		// sun is up, various calculations are made.
+		// Arrays that are only set while the sun is up are zeroed on the first sun-down
+		// timestep and left alone on the following ones (SunDownSolarZeroed).  SurfaceWindow
+		// terms are only set for windows, so except on that first sun-down timestep only the
+		// window surfaces are cleared.
 
 		// REFERENCES:
 		// (I)BLAST legacy routine QSUN
@@ -1631,7 +1817,6 @@ namespace HeatBalanceSurfaceManager {
 		using General::InterpSw;
 		using General::InterpBlind;
 		using General::InterpProfAng;
-		using General::InterpSlatAng;
 		using General::InterpProfSlatAng;
 		using General::BlindBeamBeamTrans;
 		using namespace DataDaylightingDevices;
@@ -1742,6 +1927,9 @@ namespace HeatBalanceSurfaceManager {
 		int OtherZoneNum; // Adjacent zone number
 		int SurfSolAbs; // Pointer to scheduled surface gains object for fenestration systems
 		int SurfSolIncPtr; // Pointer to schedule surface gain object for interior side of the surface
+		int Item; // Index in WindowSurf
+		bool const SunIsDown( ! SunIsUp || ( BeamSolarRad + GndSolarRad + DifSolarRad <= 0.0 ) );
+		bool const ClearAllSurfaces( SunIsDown && ! SunDownSolarZeroed ); // Clear SurfaceWindow terms of every surface
 
 		// Always initialize the shortwave quantities
 
@@ -1761,6 +1949,7 @@ namespace HeatBalanceSurfaceManager {
 		SWInAbsTotalReport = 0.0;
 		SWOutAbsTotalReport = 0.0;
 		SWOutAbsEnergyReport = 0.0;
+
 		QRadSWOutIncident = 0.0;
 		QRadSWOutIncidentBeam = 0.0;
 		BmIncInsSurfIntensRep = 0.0;
@@ -1780,7 +1969,8 @@ namespace HeatBalanceSurfaceManager {
 		BSDFBeamPhiRep = 0.0;
 		OpaqSurfInsFaceBeamSolAbsorbed = 0.0;
 
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		for ( Item = 1; Item <= ( ClearAllSurfaces ? TotSurfaces : NumWindowSurf ); ++Item ) {
+			SurfNum = ( ClearAllSurfaces ? Item : WindowSurf( Item ) );
 			SurfaceWindow( SurfNum ).FrameQRadOutAbs = 0.0;
 			SurfaceWindow( SurfNum ).FrameQRadInAbs = 0.0;
 			SurfaceWindow( SurfNum ).DividerQRadOutAbs = 0.0;
@@ -1884,7 +2074,11 @@ namespace HeatBalanceSurfaceManager {
 		BmIncInsSurfAmountRepEnergy = 0.0;
 		IntBmIncInsSurfAmountRepEnergy = 0.0;
 
-		if ( ! SunIsUp || ( BeamSolarRad + GndSolarRad + DifSolarRad <= 0.0 ) ) { // Sun is down
+		if ( SunIsDown ) {
+
+			// These stay zero until the sun comes up again
+			if ( SunDownSolarZeroed ) return;
+			SunDownSolarZeroed = true;
 
 			QD = 0.0;
 			QDforDaylight = 0.0;
@@ -1932,6 +2126,8 @@ namespace HeatBalanceSurfaceManager {
 
 		} else { // Sun is up, calculate solar quantities
 
+			SunDownSolarZeroed = false;
+
 			assert( equal_dimensions( ReflFacBmToBmSolObs, ReflFacBmToDiffSolObs ) ); // For linear indexing
 			assert( equal_dimensions( ReflFacBmToBmSolObs, ReflFacBmToDiffSolGnd ) ); // For linear indexing
 			FArray2D< Real64 >::size_type lSH( CalcSolRefl ? ReflFacBmToBmSolObs.index( 1, HourOfDay ) : 0u );
@@ -2172,16 +2368,17 @@ namespace HeatBalanceSurfaceManager {
 										}
 
 										if ( ShadeFlag == IntBlindOn || ShadeFlag == ExtBlindOn || ShadeFlag == BGBlindOn ) { // Blind on
+											auto const & BlProps( GetBlindSlatAngProperties( SurfNum, ConstrNumSh ) );
 											for ( Lay = 1; Lay <= TotGlassLay; ++Lay ) {
-												AbsDiffWin( Lay ) = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).BlAbsDiff( Lay, {1,MaxSlatAngs} ) );
-												AbsDiffWinGnd( Lay ) = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).BlAbsDiffGnd( Lay, {1,MaxSlatAngs} ) );
-												AbsDiffWinSky( Lay ) = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).BlAbsDiffSky( Lay, {1,MaxSlatAngs} ) );
+												AbsDiffWin( Lay ) = BlProps.BlAbsDiff( Lay );
+												AbsDiffWinGnd( Lay ) = BlProps.BlAbsDiffGnd( Lay );
+												AbsDiffWinSky( Lay ) = BlProps.BlAbsDiffSky( Lay );
 											}
-											SurfaceWindow( SurfNum ).ExtDiffAbsByShade = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).AbsDiffBlind ) * ( SkySolarInc + GndSolarInc );
+											SurfaceWindow( SurfNum ).ExtDiffAbsByShade = BlProps.AbsDiffBlind * ( SkySolarInc + GndSolarInc );
 											if ( Blind( SurfaceWindow( SurfNum ).BlindNumber ).SlatOrientation == Horizontal ) {
 												ACosTlt = std::abs( Surface( SurfNum ).CosTilt );
-												AbsDiffBlindGnd = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).AbsDiffBlindGnd );
-												AbsDiffBlindSky = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).AbsDiffBlindSky );
+												AbsDiffBlindGnd = BlProps.AbsDiffBlindGnd;
+												AbsDiffBlindSky = BlProps.AbsDiffBlindSky;
 												SurfaceWindow( SurfNum ).ExtDiffAbsByShade = SkySolarInc * ( 0.5 * ACosTlt * AbsDiffBlindGnd + ( 1.0 - 0.5 * ACosTlt ) * AbsDiffBlindSky ) + GndSolarInc * ( ( 1.0 - 0.5 * ACosTlt ) * AbsDiffBlindGnd + 0.5 * ACosTlt * AbsDiffBlindSky );
 											}
 										}
@@ -2205,8 +2402,8 @@ namespace HeatBalanceSurfaceManager {
 										QRadSWwinAbs( SurfNum, Lay ) = AbsDiffWin( Lay ) * ( SkySolarInc + GndSolarInc ) + AWinSurf( SurfNum, Lay ) * BeamSolar; // AWinSurf is from InteriorSolarDistribution
 										if ( ShadeFlag == IntBlindOn || ShadeFlag == ExtBlindOn || ShadeFlag == BGBlindOn ) {
 											if ( Blind( SurfaceWindow( SurfNum ).BlindNumber ).SlatOrientation == Horizontal ) {
-												AbsDiffGlassLayGnd = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).BlAbsDiffGnd( Lay, {1,19} ) );
-												AbsDiffGlassLaySky = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).BlAbsDiffSky( Lay, {1,19} ) );
+												AbsDiffGlassLayGnd = GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).BlAbsDiffGnd( Lay );
+												AbsDiffGlassLaySky = GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).BlAbsDiffSky( Lay );
 												QRadSWwinAbs( SurfNum, Lay ) = SkySolarInc * ( 0.5 * ACosTlt * AbsDiffGlassLayGnd + ( 1.0 - 0.5 * ACosTlt ) * AbsDiffGlassLaySky ) + GndSolarInc * ( ( 1.0 - 0.5 * ACosTlt ) * AbsDiffGlassLayGnd + 0.5 * ACosTlt * AbsDiffGlassLaySky ) + AWinSurf( SurfNum, Lay ) * BeamSolar;
 											}
 										}
@@ -2431,8 +2628,8 @@ namespace HeatBalanceSurfaceManager {
 											SlatAng = SurfaceWindow( SurfNum ).SlatAngThisTS;
 											TBlBmBm = BlindBeamBeamTrans( ProfAng, SlatAng, Blind( BlNum ).SlatWidth, Blind( BlNum ).SlatSeparation, Blind( BlNum ).SlatThickness );
 											TBlBmDif = InterpProfSlatAng( ProfAng, SlatAng, SurfaceWindow( SurfNum ).MovableSlats, Blind( BlNum ).SolFrontBeamDiffTrans );
-											SurfaceWindow( SurfNum ).DividerQRadOutAbs = DividerAbs * ( DivIncSolarOutBm * ( TBlBmBm + TBlBmDif ) + DivIncSolarOutDif * InterpSlatAng( SlatAng, SurfaceWindow( SurfNum ).MovableSlats, Blind( BlNum ).SolFrontDiffDiffTrans ) );
-											SurfaceWindow( SurfNum ).DividerQRadInAbs = DividerAbs * ( DivIncSolarInBm * ( TBlBmBm + TBlBmDif ) + DivIncSolarInDif * InterpSlatAng( SlatAng, SurfaceWindow( SurfNum ).MovableSlats, Blind( BlNum ).SolFrontDiffDiffTrans ) );
+											SurfaceWindow( SurfNum ).DividerQRadOutAbs = DividerAbs * ( DivIncSolarOutBm * ( TBlBmBm + TBlBmDif ) + DivIncSolarOutDif * GetBlindSlatAngProperties( SurfNum, 0 ).SolFrontDiffDiffTrans );
+											SurfaceWindow( SurfNum ).DividerQRadInAbs = DividerAbs * ( DivIncSolarInBm * ( TBlBmBm + TBlBmDif ) + DivIncSolarInDif * GetBlindSlatAngProperties( SurfNum, 0 ).SolFrontDiffDiffTrans );
 
 										} else if ( ShadeFlag == ExtShadeOn ) { // Exterior shade
 											SurfaceWindow( SurfNum ).DividerQRadOutAbs = DividerAbs * Material( Construct( ConstrNumSh ).LayerPoint( 1 ) ).Trans * ( DivIncSolarOutBm + DivIncSolarOutDif );
@@ -2508,7 +2705,6 @@ namespace HeatBalanceSurfaceManager {
 
 		// Using/Aliasing
 		using General::InterpSw;
-		using General::InterpSlatAng;
 		using namespace HeatBalanceMovableInsulation;
 		using DaylightingDevices::DistributeTDDAbsorbedSolar;
 		using namespace DataWindowEquivalentLayer;
@@ -2668,19 +2864,19 @@ namespace HeatBalanceSurfaceManager {
 						for ( IGlass = 1; IGlass <= Construct( ConstrNumSh ).TotGlassLayers; ++IGlass ) {
 							if ( ShadeFlag == IntShadeOn || ShadeFlag == ExtShadeOn || ShadeFlag == BGShadeOn || ShadeFlag == ExtScreenOn ) QRadSWwinAbs( SurfNum, IGlass ) += QS( ZoneNum ) * Construct( ConstrNumSh ).AbsDiffBack( IGlass );
 							if ( ShadeFlag == IntBlindOn || ShadeFlag == ExtBlindOn ) {
-								BlAbsDiffBk = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).BlAbsDiffBack( IGlass, _ ) );
+								BlAbsDiffBk = GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).BlAbsDiffBack( IGlass );
 								QRadSWwinAbs( SurfNum, IGlass ) += QS( ZoneNum ) * BlAbsDiffBk;
 							}
 						}
 						BlNum = SurfaceWindow( SurfNum ).BlindNumber;
 						if ( ShadeFlag == IntShadeOn ) SurfaceWindow( SurfNum ).IntLWAbsByShade = QL( ZoneNum ) * Construct( ConstrNumSh ).ShadeAbsorpThermal * TMULT( ZoneNum );
 						if ( ShadeFlag == IntBlindOn ) {
-							EffBlEmiss = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, SurfaceWindow( SurfNum ).EffShBlindEmiss );
+							EffBlEmiss = GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).EffShBlindEmiss;
 							SurfaceWindow( SurfNum ).IntLWAbsByShade = QL( ZoneNum ) * EffBlEmiss * TMULT( ZoneNum );
 						}
 						if ( ShadeFlag == IntShadeOn || ShadeFlag == ExtShadeOn || ShadeFlag == BGShadeOn || ShadeFlag == ExtScreenOn ) SurfaceWindow( SurfNum ).IntSWAbsByShade = QS( ZoneNum ) * Construct( ConstrNumSh ).AbsDiffBackShade;
 						if ( ShadeFlag == IntBlindOn || ShadeFlag == ExtBlindOn || ShadeFlag == BGBlindOn ) {
-							AbsDiffBkBl = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).AbsDiffBackBlind );
+							AbsDiffBkBl = GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).AbsDiffBackBlind;
 							SurfaceWindow( SurfNum ).IntSWAbsByShade = QS( ZoneNum ) * AbsDiffBkBl;
 						}
 						// Correct for divider shadowing
@@ -2713,8 +2909,8 @@ namespace HeatBalanceSurfaceManager {
 							DividerSolAbs *= Material( MatNumSh ).Trans;
 							DividerThermAbs *= Material( MatNumSh ).TransThermal;
 						} else if ( ShadeFlag == IntBlindOn ) {
-							DividerSolAbs *= InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Blind( BlNum ).SolBackDiffDiffTrans );
-							DividerThermAbs *= InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Blind( BlNum ).IRBackTrans );
+							DividerSolAbs *= GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).SolBackDiffDiffTrans;
+							DividerThermAbs *= GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).IRBackTrans;
 						}
 						// Note that DividerQRadInAbs is initially calculated in InitSolarHeatGains
 						SurfaceWindow( SurfNum ).DividerQRadInAbs += ( QS( ZoneNum ) * DividerSolAbs + ( QL( ZoneNum ) * TMULT( ZoneNum ) + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) ) * DividerThermAbs ) * ( 1.0 + SurfaceWindow( SurfNum ).ProjCorrDivIn );
@@ -2931,6 +3127,84 @@ namespace HeatBalanceSurfaceManager {
 
 	}
 
+	BlindSlatAngProperties const &
+	GetBlindSlatAngProperties(
+		int const SurfNum, // Window surface with a blind
+		int const ConstrNumSh // Shaded construction in use, or 0 if only the blind properties are needed
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the blind properties of a window interpolated at its current slat angle, shared by
+		// InitSolarHeatGains, InitIntSolarDistribution and the interior absorption factor routines.
+
+		// METHODOLOGY EMPLOYED:
+		// The properties are kept in SurfWinBlindProps and only re-interpolated when the window's
+		// blind (BlindNumber, which the shading manager may switch) or SlatAngThisTS differs from
+		// the one they were evaluated for; with fixed slats InterpSlatAng does not depend on the
+		// angle, so they are evaluated once per blind.  The properties of the shaded
+		// construction are evaluated separately, when a different construction is asked for
+		// (e.g. with a storm window) or after the slat angle has changed.  Values are identical to
+		// calling InterpSlatAng at each use.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::InterpSlatAng;
+
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Lay; // Glass layer number
+
+		auto & BlProps( SurfWinBlindProps( SurfNum ) );
+		auto const & SurfWin( SurfaceWindow( SurfNum ) );
+
+		if ( ! BlProps.Evaluated || SurfWin.BlindNumber != BlProps.BlindNumber || ( SurfWin.MovableSlats && SurfWin.SlatAngThisTS != BlProps.SlatAng ) ) {
+			auto const & Bl( Blind( SurfWin.BlindNumber ) );
+			BlProps.EffShBlindEmiss = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, SurfWin.EffShBlindEmiss );
+			BlProps.EffGlassEmiss = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, SurfWin.EffGlassEmiss );
+			BlProps.IRBackTrans = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, Bl.IRBackTrans );
+			BlProps.SolBackDiffDiffTrans = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, Bl.SolBackDiffDiffTrans );
+			BlProps.SolFrontDiffDiffTrans = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, Bl.SolFrontDiffDiffTrans );
+			BlProps.BlindNumber = SurfWin.BlindNumber;
+			BlProps.SlatAng = SurfWin.SlatAngThisTS;
+			BlProps.ConstrNumSh = 0;
+			BlProps.Evaluated = true;
+		}
+
+		if ( ConstrNumSh > 0 && ConstrNumSh != BlProps.ConstrNumSh ) {
+			auto const & ConstrSh( Construct( ConstrNumSh ) );
+			BlProps.BlTransDiff = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, ConstrSh.BlTransDiff );
+			BlProps.AbsDiffBlind = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, ConstrSh.AbsDiffBlind );
+			BlProps.AbsDiffBlindGnd = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, ConstrSh.AbsDiffBlindGnd );
+			BlProps.AbsDiffBlindSky = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, ConstrSh.AbsDiffBlindSky );
+			BlProps.AbsDiffBackBlind = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, ConstrSh.AbsDiffBackBlind );
+			if ( ! allocated( BlProps.BlAbsDiff ) ) {
+				BlProps.BlAbsDiff.dimension( MaxSolidWinLayers, 0.0 );
+				BlProps.BlAbsDiffGnd.dimension( MaxSolidWinLayers, 0.0 );
+				BlProps.BlAbsDiffSky.dimension( MaxSolidWinLayers, 0.0 );
+				BlProps.BlAbsDiffBack.dimension( MaxSolidWinLayers, 0.0 );
+			}
+			for ( Lay = 1; Lay <= ConstrSh.TotGlassLayers; ++Lay ) {
+				BlProps.BlAbsDiff( Lay ) = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, ConstrSh.BlAbsDiff( Lay, {1,MaxSlatAngs} ) );
+				BlProps.BlAbsDiffGnd( Lay ) = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, ConstrSh.BlAbsDiffGnd( Lay, {1,MaxSlatAngs} ) );
+				BlProps.BlAbsDiffSky( Lay ) = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, ConstrSh.BlAbsDiffSky( Lay, {1,MaxSlatAngs} ) );
+				BlProps.BlAbsDiffBack( Lay ) = InterpSlatAng( SurfWin.SlatAngThisTS, SurfWin.MovableSlats, ConstrSh.BlAbsDiffBack( Lay, {1,MaxSlatAngs} ) );
+			}
+			BlProps.ConstrNumSh = ConstrNumSh;
+		}
+
+		return BlProps;
+
+	}
+
 	void
 	ComputeIntThermalAbsorpFactors()
 	{
@@ -2948,6 +3222,9 @@ namespace HeatBalanceSurfaceManager {
 
 		// METHODOLOGY EMPLOYED:
 		// The fraction is assumed to be proportional to the product of the surface area times its thermal absorptivity.
+		// Only zones where one of the inputs changed since they were last evaluated are recomputed: a surface
+		// construction (EMS override, storm window), a window shading device, blind, slat angle or switchable glazing
+		// state set by the shading manager, or exterior movable insulation switched by its schedule.
 
 		// REFERENCES:
 		// BLAST Routine: CITAF - Compute Interior Thermal Absorption Factors
@@ -2992,24 +3269,52 @@ namespace HeatBalanceSurfaceManager {
 			ITABSF.dimension( TotSurfaces, 0.0 );
 			TMULT.dimension( NumOfZones, 0.0 );
 			TCONV.dimension( NumOfZones, 0.0 );
+			IntThermalAbsorpZoneDirty.dimension( NumOfZones, true );
+			IntThermalAbsorpConstr.dimension( TotSurfaces, 0 );
+			IntThermalAbsorpShadeFlag.dimension( TotSurfaces, 0 );
+			IntThermalAbsorpConstrSh.dimension( TotSurfaces, 0 );
+			IntThermalAbsorpBlindNum.dimension( TotSurfaces, 0 );
+			IntThermalAbsorpSlatAng.dimension( TotSurfaces, 0.0 );
+			IntThermalAbsorpSwitchFac.dimension( TotSurfaces, 0.0 );
+			IntThermalAbsorpMovInsul.dimension( TotSurfaces, false );
 		}
 
+		// Mark the zones whose inputs changed
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
+			auto const & SurfWin( SurfaceWindow( SurfNum ) );
+			ConstrNum = Surface( SurfNum ).Construction;
+			RoughIndexMovInsul = 0;
+			if ( Construct( ConstrNum ).TransDiff <= 0.0 && Surface( SurfNum ).MaterialMovInsulExt > 0 ) EvalOutsideMovableInsulation( SurfNum, HMovInsul, RoughIndexMovInsul, AbsExt );
+			if ( ConstrNum != IntThermalAbsorpConstr( SurfNum ) || SurfWin.ShadingFlag != IntThermalAbsorpShadeFlag( SurfNum ) || SurfWin.ShadedConstruction != IntThermalAbsorpConstrSh( SurfNum ) || SurfWin.BlindNumber != IntThermalAbsorpBlindNum( SurfNum ) || SurfWin.SlatAngThisTS != IntThermalAbsorpSlatAng( SurfNum ) || SurfWin.SwitchingFactor != IntThermalAbsorpSwitchFac( SurfNum ) || ( RoughIndexMovInsul > 0 ) != IntThermalAbsorpMovInsul( SurfNum ) ) {
+				if ( Surface( SurfNum ).Zone > 0 ) IntThermalAbsorpZoneDirty( Surface( SurfNum ).Zone ) = true;
+				IntThermalAbsorpConstr( SurfNum ) = ConstrNum;
+				IntThermalAbsorpShadeFlag( SurfNum ) = SurfWin.ShadingFlag;
+				IntThermalAbsorpConstrSh( SurfNum ) = SurfWin.ShadedConstruction;
+				IntThermalAbsorpBlindNum( SurfNum ) = SurfWin.BlindNumber;
+				IntThermalAbsorpSlatAng( SurfNum ) = SurfWin.SlatAngThisTS;
+				IntThermalAbsorpSwitchFac( SurfNum ) = SurfWin.SwitchingFactor;
+				IntThermalAbsorpMovInsul( SurfNum ) = ( RoughIndexMovInsul > 0 );
+			}
+		}
+
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
+			if ( Surface( SurfNum ).Zone > 0 && ! IntThermalAbsorpZoneDirty( Surface( SurfNum ).Zone ) ) continue;
 			ConstrNum = Surface( SurfNum ).Construction;
 			ShadeFlag = SurfaceWindow( SurfNum ).ShadingFlag;
 			ITABSF( SurfNum ) = Construct( ConstrNum ).InsideAbsorpThermal;
-			if ( Construct( ConstrNum ).TransDiff <= 0.0 ) { // Opaque surface
-				RoughIndexMovInsul = 0;
-				if ( Surface( SurfNum ).MaterialMovInsulExt > 0 ) EvalOutsideMovableInsulation( SurfNum, HMovInsul, RoughIndexMovInsul, AbsExt );
-				if ( RoughIndexMovInsul > 0 ) ITABSF( SurfNum ) = Material( Surface( SurfNum ).MaterialMovInsulExt ).AbsorpThermal; // Movable outside insulation present
-			}
+			if ( IntThermalAbsorpMovInsul( SurfNum ) ) ITABSF( SurfNum ) = Material( Surface( SurfNum ).MaterialMovInsulExt ).AbsorpThermal; // Movable outside insulation present
 			// For window with an interior shade or blind, emissivity is a combination of glass and shade/blind emissivity
-			if ( ShadeFlag == IntShadeOn || ShadeFlag == IntBlindOn ) ITABSF( SurfNum ) = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, SurfaceWindow( SurfNum ).EffShBlindEmiss ) + InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, SurfaceWindow( SurfNum ).EffGlassEmiss ); // For shades, following interpolation just returns value of first element in array
+			if ( ShadeFlag == IntShadeOn ) ITABSF( SurfNum ) = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, SurfaceWindow( SurfNum ).EffShBlindEmiss ) + InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, SurfaceWindow( SurfNum ).EffGlassEmiss ); // For shades, following interpolation just returns value of first element in array
+			if ( ShadeFlag == IntBlindOn ) ITABSF( SurfNum ) = GetBlindSlatAngProperties( SurfNum, 0 ).EffShBlindEmiss + GetBlindSlatAngProperties( SurfNum, 0 ).EffGlassEmiss;
 		}
 
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
+			if ( ! IntThermalAbsorpZoneDirty( ZoneNum ) ) continue;
+			IntThermalAbsorpZoneDirty( ZoneNum ) = false;
+
 			SUM1 = 0.0;
 			SUM2 = 0.0;
 
@@ -3041,8 +3346,8 @@ namespace HeatBalanceSurfaceManager {
 						TauShIR = Material( MatNumSh ).TransThermal;
 						EffShDevEmiss = SurfaceWindow( SurfNum ).EffShBlindEmiss( 1 );
 						if ( ShadeFlag == IntBlindOn ) {
-							TauShIR = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Blind( SurfaceWindow( SurfNum ).BlindNumber ).IRBackTrans );
-							EffShDevEmiss = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, SurfaceWindow( SurfNum ).EffShBlindEmiss );
+							TauShIR = GetBlindSlatAngProperties( SurfNum, 0 ).IRBackTrans;
+							EffShDevEmiss = GetBlindSlatAngProperties( SurfNum, 0 ).EffShBlindEmiss;
 						}
 						SUM1 += SurfaceWindow( SurfNum ).DividerArea * ( EffShDevEmiss + DividerThermAbs * TauShIR );
 					} else {
@@ -3097,7 +3402,6 @@ namespace HeatBalanceSurfaceManager {
 		// Using/Aliasing
 		using namespace HeatBalanceMovableInsulation;
 		using General::InterpSw;
-		using General::InterpSlatAng;
 		using namespace DataWindowEquivalentLayer;
 
 		// Locals
@@ -3198,7 +3502,7 @@ namespace HeatBalanceSurfaceManager {
 							if ( ShadeFlag == IntShadeOn || ShadeFlag == ExtShadeOn || ShadeFlag == BGShadeOn || ShadeFlag == ExtScreenOn ) {
 								AbsDiffLayWin = Construct( ConstrNumSh ).AbsDiffBack( Lay );
 							} else if ( ShadeFlag == IntBlindOn || ShadeFlag == ExtBlindOn || ShadeFlag == BGBlindOn ) {
-								AbsDiffLayWin = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).BlAbsDiffBack( Lay, _ ) );
+								AbsDiffLayWin = GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).BlAbsDiffBack( Lay );
 							}
 
 							// Switchable glazing
@@ -3216,8 +3520,8 @@ namespace HeatBalanceSurfaceManager {
 							TransDiffWin = Construct( ConstrNumSh ).TransDiff;
 							DiffAbsShade = Construct( ConstrNumSh ).AbsDiffBackShade;
 						} else if ( ShadeFlag == IntBlindOn || ShadeFlag == ExtBlindOn || ShadeFlag == BGBlindOn ) {
-							TransDiffWin = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).BlTransDiff );
-							DiffAbsShade = InterpSlatAng( SurfaceWindow( SurfNum ).SlatAngThisTS, SurfaceWindow( SurfNum ).MovableSlats, Construct( ConstrNumSh ).AbsDiffBackBlind );
+							TransDiffWin = GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).BlTransDiff;
+							DiffAbsShade = GetBlindSlatAngProperties( SurfNum, ConstrNumSh ).AbsDiffBackBlind;
 						}
 
 						// Switchable glazing
@@ -3557,7 +3861,14 @@ namespace HeatBalanceSurfaceManager {
 		static bool SurfConstructOverridesPresent( false ); // detect if EMS ever used for this and inits need to execute
 		int SurfNum;
 
-		if ( any( Surface.EMSConstructionOverrideON() ) ) SurfConstructOverridesPresent = true;
+		if ( ! SurfConstructOverridesPresent ) {
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( Surface( SurfNum ).EMSConstructionOverrideON ) {
+					SurfConstructOverridesPresent = true;
+					break;
+				}
+			}
+		}
 
 		if ( ! SurfConstructOverridesPresent ) return;
 
@@ -3663,11 +3974,126 @@ namespace HeatBalanceSurfaceManager {
 			} else {
 				Surface( SurfNum ).Construction = Surface( SurfNum ).ConstructionStoredInputValue;
 			}
+			SurfConstruction( SurfNum ) = Surface( SurfNum ).Construction;
 
 		}
 
 	}
 
+	void
+	InitSurfaceHotFields()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Fill the compact per-surface arrays (SurfZone, SurfClass, ...) that the outside and
+		// inside heat balance loops read instead of the full Surface derived type.
+
+		// METHODOLOGY EMPLOYED:
+		// Called once after the surface geometry is complete.  Of these fields only the
+		// construction can change during the run; code that changes Surface%Construction
+		// must also set SurfConstruction (see InitEMSControlledConstructions).  The CondFD
+		// surface list is also built here, since the heat transfer algorithm is fixed, and
+		// the list of window surfaces used by InitSolarHeatGains.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum;
+
+		SurfZone.dimension( TotSurfaces, 0 );
+		SurfClass.dimension( TotSurfaces, 0 );
+		SurfHeatTransSurf.dimension( TotSurfaces, false );
+		SurfHeatTransferAlgorithm.dimension( TotSurfaces, 0 );
+		SurfExtBoundCond.dimension( TotSurfaces, 0 );
+		SurfConstruction.dimension( TotSurfaces, 0 );
+		SurfArea.dimension( TotSurfaces, 0.0 );
+		SurfExtEcoRoof.dimension( TotSurfaces, false );
+		SurfOSCMPtr.dimension( TotSurfaces, 0 );
+		CondFDSurf.dimension( TotSurfaces, 0 );
+		NumCondFDSurf = 0;
+		WindowSurf.dimension( TotSurfaces, 0 );
+		NumWindowSurf = 0;
+
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			SurfZone( SurfNum ) = Surface( SurfNum ).Zone;
+			SurfClass( SurfNum ) = Surface( SurfNum ).Class;
+			SurfHeatTransSurf( SurfNum ) = Surface( SurfNum ).HeatTransSurf;
+			SurfHeatTransferAlgorithm( SurfNum ) = Surface( SurfNum ).HeatTransferAlgorithm;
+			SurfExtBoundCond( SurfNum ) = Surface( SurfNum ).ExtBoundCond;
+			SurfConstruction( SurfNum ) = Surface( SurfNum ).Construction;
+			SurfArea( SurfNum ) = Surface( SurfNum ).Area;
+			SurfExtEcoRoof( SurfNum ) = Surface( SurfNum ).ExtEcoRoof;
+			SurfOSCMPtr( SurfNum ) = Surface( SurfNum ).OSCMPtr;
+			if ( Surface( SurfNum ).Construction > 0 && Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) { // Not a shading surface
+				++NumCondFDSurf;
+				CondFDSurf( NumCondFDSurf ) = SurfNum;
+			}
+			if ( Surface( SurfNum ).Class == SurfaceClass_Window || Surface( SurfNum ).Class == SurfaceClass_TDD_Dome ) {
+				++NumWindowSurf;
+				WindowSurf( NumWindowSurf ) = SurfNum;
+			}
+		}
+
+	}
+
+	void
+	InitSurfaceCTFZeroTerms()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gather the zero-term CTF coefficients of each surface's current construction into
+		// contiguous per-surface arrays for CalcCTFOutFaceCoupling.
+
+		// METHODOLOGY EMPLOYED:
+		// Called every timestep after any EMS construction overrides have been applied.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum;
+		int ConstrNum;
+
+		if ( ! allocated( SurfCTFOutside0 ) ) {
+			SurfCTFOutside0.dimension( TotSurfaces, 0.0 );
+			SurfCTFInside0.dimension( TotSurfaces, 0.0 );
+			SurfCTFCross0.dimension( TotSurfaces, 0.0 );
+			SurfCTFSourceOut0.dimension( TotSurfaces, 0.0 );
+			SurfCTFSourceIn0.dimension( TotSurfaces, 0.0 );
+			CTFOutFaceCondConst.dimension( TotSurfaces, 0.0 );
+			CTFOutFaceCondCoef.dimension( TotSurfaces, 0.0 );
+			OutsideBatchSurf.dimension( TotSurfaces, 0 );
+			OutsideBatchTempExt.dimension( TotSurfaces, 0.0 );
+		}
+
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			ConstrNum = SurfConstruction( SurfNum );
+			if ( ! SurfHeatTransSurf( SurfNum ) || ConstrNum <= 0 ) continue;
+			if ( Construct( ConstrNum ).TypeIsWindow ) continue;
+			SurfCTFOutside0( SurfNum ) = Construct( ConstrNum ).CTFOutside( 0 );
+			SurfCTFInside0( SurfNum ) = Construct( ConstrNum ).CTFInside( 0 );
+			SurfCTFCross0( SurfNum ) = Construct( ConstrNum ).CTFCross( 0 );
+			SurfCTFSourceOut0( SurfNum ) = Construct( ConstrNum ).CTFSourceOut( 0 );
+			SurfCTFSourceIn0( SurfNum ) = Construct( ConstrNum ).CTFSourceIn( 0 );
+		}
+
+	}
+
 	// End Initialization Section of the Module
 	//******************************************************************************
 
@@ -3787,21 +4213,8 @@ namespace HeatBalanceSurfaceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int HistTermNum; // DO loop counter for history terms
-		int SideNum; // DO loop counter for surfaces sides (inside, outside)
 		int SurfNum; // Surface number DO loop counter
-		int ZoneNum; // Zone number DO loop counter
-
-		static FArray1D< Real64 > QExt1; // Heat flux at the exterior surface during first time step/series
-		static FArray1D< Real64 > QInt1; // Heat flux at the interior surface during first time step/series
-		static FArray1D< Real64 > TempInt1; // Temperature of interior surface during first time step/series
-		static FArray1D< Real64 > TempExt1; // Temperature of exterior surface during first time step/series
-		static FArray1D< Real64 > Qsrc1; // Heat source/sink (during first time step/series)
-		static FArray1D< Real64 > Tsrc1; // Temperature at source/sink (during first time step/series)
-		static FArray1D< Real64 > SumTime; // Amount of time that has elapsed from start of master history to
-		// the current time step
-
-		static bool FirstTimeFlag( true );
+
 		// FLOW:
 
 		//Tuned Assure safe to use shared linear indexing below
@@ -3812,28 +4225,18 @@ namespace HeatBalanceSurfaceManager {
 		assert( equal_dimensions( TsrcHist, TsrcHistM ) );
 		assert( equal_dimensions( TsrcHistM, QsrcHistM ) );
 
-		if ( FirstTimeFlag ) {
-			QExt1.dimension( TotSurfaces, 0.0 );
-			QInt1.dimension( TotSurfaces, 0.0 );
-			TempInt1.dimension( TotSurfaces, 0.0 );
-			TempExt1.dimension( TotSurfaces, 0.0 );
-			SumTime.dimension( TotSurfaces, 0.0 );
-			Qsrc1.dimension( TotSurfaces, 0.0 );
-			Tsrc1.dimension( TotSurfaces, 0.0 );
-			FirstTimeFlag = false;
-		}
-
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all (heat transfer) surfaces...
+		// Surfaces are independent: run on HeatBalanceThreads threads
+		HeatBalanceParallelFor( 1, TotSurfaces, [&]( int const SurfNum ) { // Loop through all (heat transfer) surfaces...
 			auto const & surface( Surface( SurfNum ) );
 
-			if ( surface.Class == SurfaceClass_Window || ! surface.HeatTransSurf ) continue;
+			if ( surface.Class == SurfaceClass_Window || ! surface.HeatTransSurf ) return;
 
-			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) ) continue;
+			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) ) return;
 
 			int const ConstrNum( surface.Construction );
 			auto const & construct( Construct( ConstrNum ) );
 
-			if ( construct.NumCTFTerms == 0 ) continue; // Skip surfaces with no history terms
+			if ( construct.NumCTFTerms == 0 ) return; // Skip surfaces with no history terms
 
 			// Sign convention for the various terms in the following two equations
 			// is based on the form of the Conduction Transfer Function equation
@@ -3865,7 +4268,7 @@ namespace HeatBalanceSurfaceManager {
 				TempSource( SurfNum ) = TsrcHist( SurfNum, 1 );
 			}
 
-			if ( surface.ExtBoundCond > 0 ) continue; // Don't need to evaluate outside for partitions
+			if ( surface.ExtBoundCond > 0 ) return; // Don't need to evaluate outside for partitions
 
 			// Set current outside flux:
 			QH( SurfNum, 1, 1 ) = TH( SurfNum, 1, 1 ) * construct.CTFOutside( 0 ) - TempSurfIn( SurfNum ) * construct.CTFCross( 0 ) + QsrcHist( SurfNum, 1 ) * construct.CTFSourceOut( 0 ) + CTFConstOutPart( SurfNum ); // Heat source/sink term for radiant systems
@@ -3876,7 +4279,7 @@ namespace HeatBalanceSurfaceManager {
 
 			}
 
-		} // ...end of loop over all (heat transfer) surfaces...
+		} ); // ...end of loop over all (heat transfer) surfaces...
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all (heat transfer) surfaces...
 			auto const & surface( Surface( SurfNum ) );
@@ -3896,11 +4299,12 @@ namespace HeatBalanceSurfaceManager {
 
 		// SHIFT TEMPERATURE AND FLUX HISTORIES:
 		// SHIFT AIR TEMP AND FLUX SHIFT VALUES WHEN AT BOTTOM OF ARRAY SPACE.
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all (heat transfer) surfaces...
+		// Surfaces are independent: run on HeatBalanceThreads threads
+		HeatBalanceParallelFor( 1, TotSurfaces, [&]( int const SurfNum ) { // Loop through all (heat transfer) surfaces...
 			auto const & surface( Surface( SurfNum ) );
 
-			if ( surface.Class == SurfaceClass_Window || surface.Class == SurfaceClass_TDD_Dome || ! surface.HeatTransSurf ) continue;
-			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_TDD ) ) continue;
+			if ( surface.Class == SurfaceClass_Window || surface.Class == SurfaceClass_TDD_Dome || ! surface.HeatTransSurf ) return;
+			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_TDD ) ) return;
 
 			int const ConstrNum( surface.Construction );
 			auto const & construct( Construct( ConstrNum ) );
@@ -3913,8 +4317,8 @@ namespace HeatBalanceSurfaceManager {
 				SUMH( SurfNum ) = 0;
 
 				if ( construct.NumCTFTerms > 1 ) {
-					for ( SideNum = 1; SideNum <= 2; ++SideNum ) { //Tuned Index order switched for cache friendliness
-						for ( HistTermNum = construct.NumCTFTerms + 1; HistTermNum >= 3; --HistTermNum ) { //Tuned Linear indexing
+					for ( int SideNum = 1; SideNum <= 2; ++SideNum ) { //Tuned Index order switched for cache friendliness
+						for ( int HistTermNum = construct.NumCTFTerms + 1; HistTermNum >= 3; --HistTermNum ) { //Tuned Linear indexing
 							//TH( SurfNum, HistTermNum, SideNum ) = THM( SurfNum, HistTermNum, SideNum ) = THM( SurfNum, HistTermNum - 1, SideNum );
 							//QH( SurfNum, HistTermNum, SideNum ) = QHM( SurfNum, HistTermNum, SideNum ) = QHM( SurfNum, HistTermNum - 1, SideNum );
 							auto const l( TH.index( SurfNum, HistTermNum, SideNum ) ); // Linear index
@@ -3923,7 +4327,7 @@ namespace HeatBalanceSurfaceManager {
 							QH[ l ] = QHM[ l ] = QHM[ m ];
 						}
 					}
-					for ( HistTermNum = construct.NumCTFTerms + 1; HistTermNum >= 3; --HistTermNum ) { //Tuned Linear indexing
+					for ( int HistTermNum = construct.NumCTFTerms + 1; HistTermNum >= 3; --HistTermNum ) { //Tuned Linear indexing
 						//TsrcHistM( SurfNum, HistTermNum ) = TsrcHistM( SurfNum, HistTermNum - 1 );
 						//TsrcHist( SurfNum, HistTermNum ) = TsrcHistM( SurfNum, HistTermNum );
 						//QsrcHistM( SurfNum, HistTermNum ) = QsrcHistM( SurfNum, HistTermNum - 1 );
@@ -3970,8 +4374,8 @@ namespace HeatBalanceSurfaceManager {
 
 				Real64 const sum_steps( SumTime( SurfNum ) / construct.CTFTimeStep );
 				if ( construct.NumCTFTerms > 1 ) {
-					for ( SideNum = 1; SideNum <= 2; ++SideNum ) { //Tuned Index order switched for cache friendliness
-						for ( HistTermNum = construct.NumCTFTerms + 1; HistTermNum >= 3; --HistTermNum ) { //Tuned Linear indexing
+					for ( int SideNum = 1; SideNum <= 2; ++SideNum ) { //Tuned Index order switched for cache friendliness
+						for ( int HistTermNum = construct.NumCTFTerms + 1; HistTermNum >= 3; --HistTermNum ) { //Tuned Linear indexing
 							//Real64 const THM_elem( THM( SurfNum, HistTermNum, SideNum ) );
 							//TH( SurfNum, HistTermNum, SideNum ) = THM_elem - ( THM_elem - THM( SurfNum, HistTermNum - 1, SideNum ) ) * sum_steps;
 							//Real64 const QHM_elem( QHM( SurfNum, HistTermNum, SideNum ) );
@@ -3984,7 +4388,7 @@ namespace HeatBalanceSurfaceManager {
 							QH[ l ] = QHM_elem - ( QHM_elem - QHM[ m ] ) * sum_steps;
 						}
 					}
-					for ( HistTermNum = construct.NumCTFTerms + 1; HistTermNum >= 3; --HistTermNum ) { //Tuned Linear indexing
+					for ( int HistTermNum = construct.NumCTFTerms + 1; HistTermNum >= 3; --HistTermNum ) { //Tuned Linear indexing
 						//Real64 const TsrcHistM_elem( TsrcHistM( SurfNum, HistTermNum ) );
 						//TsrcHist( SurfNum, HistTermNum ) = TsrcHistM_elem - ( TsrcHistM_elem - TsrcHistM( SurfNum, HistTermNum - 1 ) ) * sum_steps;
 						//Real64 const QsrcHistM_elem( QsrcHistM( SurfNum, HistTermNum ) );
@@ -4021,26 +4425,27 @@ namespace HeatBalanceSurfaceManager {
 
 			}
 
-		} // ...end of loop over all (heat transfer) surfaces
+		} ); // ...end of loop over all (heat transfer) surfaces
 
 	}
 
 	void
-	CalculateZoneMRT( Optional_int_const ZoneToResimulate ) // if passed in, then only calculate surfaces that have this zone
+	UpdateInsideSurfTempHistory()
 	{
 
 		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Rick Strand
-		//       DATE WRITTEN   November 2000
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
 		//       MODIFIED       na
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		// Calculates the current zone MRT for thermal comfort and radiation
-		// calculation purposes.
+		// Keeps the converged inside face temperatures of the last three zone timesteps
+		// for the starting-value predictor in CalcHeatBalanceInsideSurf.
 
 		// METHODOLOGY EMPLOYED:
-		// If you have to ask...
+		// Called once per zone timestep after the final surface heat balance, so partial
+		// resimulations and radiant system passes never enter the history.
 
 		// REFERENCES:
 		// na
@@ -4048,222 +4453,2101 @@ namespace HeatBalanceSurfaceManager {
 		// USE STATEMENTS:
 		// na
 
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum; // Surface number DO loop counter
 
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
+		// FLOW:
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			TempSurfInHist( SurfNum, 3 ) = TempSurfInHist( SurfNum, 2 );
+			TempSurfInHist( SurfNum, 2 ) = TempSurfInHist( SurfNum, 1 );
+			TempSurfInHist( SurfNum, 1 ) = TempSurfIn( SurfNum );
+		}
+		NumTempSurfInHist = min( NumTempSurfInHist + 1, 3 );
+		TempSurfInPredictPending = true;
 
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
+	}
 
-		// DERIVED TYPE DEFINITIONS:
+	void
+	ManageHeatBalanceCheckpoints()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Chunk scheduler of a time-decomposed run (HeatBalance:TimeDecomposition): starts a chunk
+		// from the checkpoint at its start boundary, writes checkpoints at the chunk boundaries and
+		// compares them with a serial reference run.  Called by ManageHeatBalance at the end of each
+		// zone timestep.
+
+		// METHODOLOGY EMPLOYED:
+		// Only the weather file run period is decomposed; sizing, design days and warmup days are
+		// skipped.  Days are numbered in the full run period: chunk k > 0 covers days
+		// (k-1)*ChunkLength+1 to k*ChunkLength and its run starts ChunkOverlapDays earlier (chunk 1
+		// has no overlap).  A boundary lies at the end of every ChunkLength-th day, and its
+		// checkpoint is <CheckpointFilePrefix>_<day>.ckpt.
+		// - Chunk 0, the serial reference run, writes the checkpoints of all boundaries.
+		// - Chunk k writes the checkpoint of the boundary at its end.  Without overlap it continues,
+		//   once its warmup has converged, from the checkpoint of the boundary at its start, written by
+		//   chunk k-1 or by a reference run; with overlap it starts from its own warmup and the overlap
+		//   days wash out the initial condition error.
+		// - With CheckpointReferencePrefix, the state at every boundary the run reaches, including the
+		//   end of the overlap, is compared with the reference run's checkpoint (ReportCheckpointDifferences).
+
+		// REFERENCES:
 		// na
 
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool firstTime( true ); // Flag for first time calculations
-		Real64 SumAET; // Intermediate calculational variable (area*emissivity*T) sum
-		static FArray1D< Real64 > SurfaceAE; // Product of area and emissivity for each surface
-		int SurfNum; // Surface number
-		static FArray1D< Real64 > ZoneAESum; // Sum of area times emissivity for all zone surfaces
-		int ZoneNum; // Zone number
+		static bool RestartDone( false ); // True once the chunk was started from its checkpoint
+		static bool ChunkEndWarned( false ); // True once a run past the end of the chunk was reported
+		static HeatBalanceCheckpoint State; // Current state at the chunk boundary
+		static HeatBalanceCheckpoint Reference; // State of the reference run at the chunk boundary
+		int StartBoundary; // Day of the full run period at whose end this chunk starts
+		int EndBoundary; // Day of the full run period at whose end this chunk ends (chunk > 0)
+		int FullDay; // Day of the full run period that ends now
+		std::string FileName; // Checkpoint file
+		bool ErrorsFound; // Set if a checkpoint file cannot be read
 
 		// FLOW:
-		if ( firstTime ) {
-			SurfaceAE.allocate( TotSurfaces );
-			ZoneAESum.allocate( NumOfZones );
-			SurfaceAE = 0.0;
-			ZoneAESum = 0.0;
-			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-				if ( Surface( SurfNum ).HeatTransSurf ) {
-					SurfaceAE( SurfNum ) = Surface( SurfNum ).Area * Construct( Surface( SurfNum ).Construction ).InsideAbsorpThermal;
-					ZoneNum = Surface( SurfNum ).Zone;
-					if ( ZoneNum > 0 ) ZoneAESum( ZoneNum ) += SurfaceAE( SurfNum );
-				}
+		if ( ! TimeDecompositionUsed ) return;
+		if ( DoingSizing || WarmupFlag || ! EndDayFlag || KindOfSim != ksRunPeriodWeather ) return;
+
+		StartBoundary = max( ChunkNumber - 1, 0 ) * ChunkLength;
+		EndBoundary = ChunkNumber * ChunkLength;
+
+		if ( DayOfSim == 0 ) { // Warmup has just converged
+			if ( StartBoundary > 0 && ChunkOverlapDays == 0 && ! RestartDone ) {
+				FileName = CheckpointFilePrefix + '_' + RoundSigDigits( StartBoundary ) + ".ckpt";
+				ErrorsFound = false;
+				ReadHeatBalanceCheckpoint( FileName, State, ErrorsFound );
+				if ( ErrorsFound ) ShowFatalError( "ManageHeatBalanceCheckpoints: Cannot start chunk " + RoundSigDigits( ChunkNumber ) + " from \"" + FileName + "\"." );
+				RestoreHeatBalanceCheckpoint( State );
+				RestartDone = true;
 			}
+			return;
 		}
 
-		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-			if ( present( ZoneToResimulate ) && ( ZoneNum != ZoneToResimulate ) ) continue;
-			SumAET = 0.0;
-			for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
-				if ( Surface( SurfNum ).HeatTransSurf ) {
-					SumAET += SurfaceAE( SurfNum ) * TempSurfIn( SurfNum );
-				}
+		FullDay = DayOfSim + StartBoundary - min( ChunkOverlapDays, StartBoundary );
+		if ( ChunkNumber > 0 && FullDay > EndBoundary ) {
+			if ( ! ChunkEndWarned ) {
+				ShowWarningError( "ManageHeatBalanceCheckpoints: The run of chunk " + RoundSigDigits( ChunkNumber ) + " continues past the end of the chunk." );
+				ShowContinueError( "...Its RunPeriod should end on day " + RoundSigDigits( EndBoundary ) + " of the full run period; later days are not checkpointed." );
+				ChunkEndWarned = true;
 			}
-			if ( ZoneAESum( ZoneNum ) > 0.01 ) {
-				MRT( ZoneNum ) = SumAET / ZoneAESum( ZoneNum );
+			return;
+		}
+		if ( mod( FullDay, ChunkLength ) != 0 ) return;
+
+		CaptureHeatBalanceCheckpoint( State );
+		if ( ChunkNumber == 0 || FullDay == EndBoundary ) {
+			WriteHeatBalanceCheckpoint( State, CheckpointFilePrefix + '_' + RoundSigDigits( FullDay ) + ".ckpt" );
+		}
+		if ( ! CheckpointReferencePrefix.empty() ) {
+			FileName = CheckpointReferencePrefix + '_' + RoundSigDigits( FullDay ) + ".ckpt";
+			ErrorsFound = false;
+			ReadHeatBalanceCheckpoint( FileName, Reference, ErrorsFound );
+			if ( ErrorsFound ) {
+				ShowContinueError( "...The boundary at the end of day " + RoundSigDigits( FullDay ) + " is not compared." );
 			} else {
-				if ( firstTime ) {
-					ShowWarningError( "Zone areas*inside surface emissivities are summing to zero, for Zone=\"" + Zone( ZoneNum ).Name + "\"" );
-					ShowContinueError( "As a result, MRT will be set to MAT for that zone" );
-				}
-				MRT( ZoneNum ) = MAT( ZoneNum );
+				ReportCheckpointDifferences( Reference, "Chunk " + RoundSigDigits( ChunkNumber ) + " Day " + RoundSigDigits( FullDay ) );
 			}
 		}
 
-		firstTime = false;
-
 	}
 
-	// End of Record Keeping subroutines for the HB Module
-	// *****************************************************************************
-
-	// Beginning of Reporting subroutines for the HB Module
-	// *****************************************************************************
-
 	void
-	ReportSurfaceHeatBalance()
+	CaptureHeatBalanceCheckpoint( HeatBalanceCheckpoint & State ) // State filled from the current simulation
 	{
 
 		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Linda Lawrie
-		//       DATE WRITTEN   Oct 2000
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
 		//       MODIFIED       na
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		// This subroutine puts the reporting part of the HBSurface Module in one area.
+		// Copies the heat balance state that carries over from one zone timestep to the
+		// next, so that a chunk of a run period can start from it (RestoreHeatBalanceCheckpoint)
+		// or be compared with another run at the chunk boundary (ReportCheckpointDifferences).
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// Called between zone timesteps, after UpdateThermalHistories.  Besides the histories this
+		// takes the master history interpolation state of UpdateThermalHistories, the iteration
+		// state of CalcHeatBalanceInsideSurf and the state of both green roof models, which are
+		// kept at module level for this purpose.  Conduction finite difference and HAMT node
+		// states are not included.
 
 		// REFERENCES:
 		// na
 
-		// Using/Aliasing
-		using SolarShading::ReportSurfaceShading;
-		using OutputReportTabular::lightSWRadSeq;
-		using OutputReportTabular::feneSolarRadSeq;
-		using DataGlobals::NumOfTimeStepInHour;
-		using DataGlobals::CompLoadReportIsReq;
-		using DataGlobals::isPulseZoneSizing;
-		using DataSizing::CurOverallSimDay;
+		// FLOW:
+		State.TH = TH;
+		State.QH = QH;
+		State.THM = THM;
+		State.QHM = QHM;
+		State.TsrcHist = TsrcHist;
+		State.QsrcHist = QsrcHist;
+		State.TsrcHistM = TsrcHistM;
+		State.QsrcHistM = QsrcHistM;
+		State.SUMH = SUMH;
+		State.SumTime = SumTime;
+		State.QExt1 = QExt1;
+		State.QInt1 = QInt1;
+		State.TempExt1 = TempExt1;
+		State.TempInt1 = TempInt1;
+		State.Qsrc1 = Qsrc1;
+		State.Tsrc1 = Tsrc1;
+		State.TempSurfIn = TempSurfIn;
+		State.TempSurfInTmp = TempSurfInTmp;
+		State.TempSurfOut = TempSurfOut;
+		State.TempInsOld = TempInsOld;
+		State.RefAirTemp = RefAirTemp;
+		State.HConvInEvalDelTemp = HConvInEvalDelTemp;
+		State.MAT = MAT;
+		State.ZT = ZT;
+		State.ZTAV = ZTAV;
+		State.XMAT = XMAT;
+		State.XM2T = XM2T;
+		State.XM3T = XM3T;
+		State.XM4T = XM4T;
+		State.XMPT = XMPT;
+		State.ZoneTMX = ZoneTMX;
+		State.ZoneTM2 = ZoneTM2;
+		State.ZoneAirHumRat = ZoneAirHumRat;
+		State.ZoneAirHumRatAvg = ZoneAirHumRatAvg;
+		State.ZoneAirHumRatOld = ZoneAirHumRatOld;
+		State.SoilMoisture = EcoRoofManager::Moisture;
+		State.RootMoisture = EcoRoofManager::MeanRootMoisture;
+		State.LeafTempPrev = EcoRoofManager::Tfold;
+		State.GroundTempPrev = EcoRoofManager::Tgold;
+		State.LeafVaporFlux = EcoRoofManager::Vfluxf;
+		State.GroundVaporFlux = EcoRoofManager::Vfluxg;
+		State.PlantCoverSoilMoisture = EcoRoofManager::PlantCoverMoisture;
+		State.PlantCoverRootMoisture = EcoRoofManager::PlantCoverMeanRootMoisture;
+		State.PlantCoverLeafVaporFlux = EcoRoofManager::PlantCoverVfluxf;
+		State.PlantCoverGroundVaporFlux = EcoRoofManager::PlantCoverVfluxg;
+		State.PlantTemp = EcoRoofManager::T_plant;
+		State.SoilTemp = EcoRoofManager::T_soil;
+		State.BareSoilTemp = EcoRoofManager::T_bare_soil;
+		State.AvgSoilTemp = EcoRoofManager::Tsoil_avg;
+		State.CumRunoff = EcoRoofManager::CumRunoff;
+		State.CumET = EcoRoofManager::CumET;
+		State.CumPrecip = EcoRoofManager::CumPrecip;
+		State.CumIrrigation = EcoRoofManager::CumIrrigation;
 
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-		// na
+	}
 
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
+	void
+	RestoreHeatBalanceCheckpoint( HeatBalanceCheckpoint const & State ) // State to continue the simulation from
+	{
 
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
 
-		// DERIVED TYPE DEFINITIONS:
+		// PURPOSE OF THIS SUBROUTINE:
+		// Makes a state taken by CaptureHeatBalanceCheckpoint the current heat balance state.
+
+		// METHODOLOGY EMPLOYED:
+		// The state must come from the same input (same surfaces and CTF term counts).  The
+		// inside surface temperature predictor history is cleared since it no longer applies.
+
+		// REFERENCES:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int SurfNum;
-		int ZoneNum;
-		static int TimeStepInDay( 0 );
+		// FLOW:
+		TH = State.TH;
+		QH = State.QH;
+		THM = State.THM;
+		QHM = State.QHM;
+		TsrcHist = State.TsrcHist;
+		QsrcHist = State.QsrcHist;
+		TsrcHistM = State.TsrcHistM;
+		QsrcHistM = State.QsrcHistM;
+		SUMH = State.SUMH;
+		SumTime = State.SumTime;
+		QExt1 = State.QExt1;
+		QInt1 = State.QInt1;
+		TempExt1 = State.TempExt1;
+		TempInt1 = State.TempInt1;
+		Qsrc1 = State.Qsrc1;
+		Tsrc1 = State.Tsrc1;
+		TempSurfIn = State.TempSurfIn;
+		TempSurfInTmp = State.TempSurfInTmp;
+		TempSurfOut = State.TempSurfOut;
+		TempInsOld = State.TempInsOld;
+		RefAirTemp = State.RefAirTemp;
+		HConvInEvalDelTemp = State.HConvInEvalDelTemp;
+		MAT = State.MAT;
+		ZT = State.ZT;
+		ZTAV = State.ZTAV;
+		XMAT = State.XMAT;
+		XM2T = State.XM2T;
+		XM3T = State.XM3T;
+		XM4T = State.XM4T;
+		XMPT = State.XMPT;
+		ZoneTMX = State.ZoneTMX;
+		ZoneTM2 = State.ZoneTM2;
+		ZoneAirHumRat = State.ZoneAirHumRat;
+		ZoneAirHumRatAvg = State.ZoneAirHumRatAvg;
+		ZoneAirHumRatOld = State.ZoneAirHumRatOld;
+		EcoRoofManager::Moisture = State.SoilMoisture;
+		EcoRoofManager::MeanRootMoisture = State.RootMoisture;
+		EcoRoofManager::Tfold = State.LeafTempPrev;
+		EcoRoofManager::Tgold = State.GroundTempPrev;
+		EcoRoofManager::Vfluxf = State.LeafVaporFlux;
+		EcoRoofManager::Vfluxg = State.GroundVaporFlux;
+		EcoRoofManager::PlantCoverMoisture = State.PlantCoverSoilMoisture;
+		EcoRoofManager::PlantCoverMeanRootMoisture = State.PlantCoverRootMoisture;
+		EcoRoofManager::PlantCoverVfluxf = State.PlantCoverLeafVaporFlux;
+		EcoRoofManager::PlantCoverVfluxg = State.PlantCoverGroundVaporFlux;
+		EcoRoofManager::T_plant = State.PlantTemp;
+		EcoRoofManager::T_soil = State.SoilTemp;
+		EcoRoofManager::T_bare_soil = State.BareSoilTemp;
+		EcoRoofManager::Tsoil_avg = State.AvgSoilTemp;
+		EcoRoofManager::CumRunoff = State.CumRunoff;
+		EcoRoofManager::CumET = State.CumET;
+		EcoRoofManager::CumPrecip = State.CumPrecip;
+		EcoRoofManager::CumIrrigation = State.CumIrrigation;
+		NumTempSurfInHist = 0;
 
-		ZoneMRT( {1,NumOfZones} ) = MRT( {1,NumOfZones} );
+	}
 
-		ReportSurfaceShading();
+	void
+	WriteHeatBalanceCheckpoint(
+		HeatBalanceCheckpoint const & State, // State to write
+		std::string const & FileName // Checkpoint file
+	)
+	{
 
-		// update inside face radiation reports
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-			QdotRadNetSurfInRep( SurfNum ) = NetLWRadToSurf( SurfNum ) * Surface( SurfNum ).Area;
-			QdotRadNetSurfInRepPerArea( SurfNum ) = NetLWRadToSurf( SurfNum );
-			QRadNetSurfInReport( SurfNum ) = QdotRadNetSurfInRep( SurfNum ) * SecInHour * TimeStepZone;
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
 
-			if ( Surface( SurfNum ).Class != SurfaceClass_Window ) { // not a window...
-				QdotRadSolarInRepPerArea( SurfNum ) = QRadSWInAbs( SurfNum ) - QRadSWLightsInAbs( SurfNum );
-				QdotRadSolarInRep( SurfNum ) = QdotRadSolarInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
-				QRadSolarInReport( SurfNum ) = QdotRadSolarInRep( SurfNum ) * SecInHour * TimeStepZone;
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes a heat balance checkpoint to a file so that another process can start a
+		// chunk of the run period from it or compare against it.
 
-				QdotRadLightsInRepPerArea( SurfNum ) = QRadSWLightsInAbs( SurfNum );
+		// METHODOLOGY EMPLOYED:
+		// Unformatted (binary) file.  A header holds HeatBalanceCheckpointMagic, the layout version,
+		// the member counts and the number of surfaces, zones and CTF terms; then each array is
+		// written as its element count (64-bit integer) followed by its elements in storage order,
+		// so values are restored exactly.
+
+		// REFERENCES:
+		// na
+
+		// FLOW:
+		std::ofstream CheckpointFile( FileName, std::ios::binary );
+		if ( ! CheckpointFile ) {
+			ShowFatalError( "WriteHeatBalanceCheckpoint: Could not open file \"" + FileName + "\" for output (write)." );
+		}
+
+		WriteCheckpointHeader( CheckpointFile, HeatBalanceCheckpointMagic, State );
+		WriteCheckpointState( CheckpointFile, State );
+
+		CheckpointFile.close();
+		if ( CheckpointFile.fail() ) {
+			ShowFatalError( "WriteHeatBalanceCheckpoint: Error writing file \"" + FileName + "\"." );
+		}
+
+	}
+
+	void
+	ReadHeatBalanceCheckpoint(
+		std::string const & FileName, // Checkpoint file
+		HeatBalanceCheckpoint & State, // State read from the file
+		bool & ErrorsFound // Set to true if the file cannot be read or does not match this input
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads a checkpoint written by WriteHeatBalanceCheckpoint.
+
+		// METHODOLOGY EMPLOYED:
+		// The header must carry the same magic and version and the current numbers of surfaces,
+		// zones and CTF terms.  The arrays of State are dimensioned like the current simulation's
+		// arrays; a file whose element counts differ, that ends early or that has data left over
+		// is rejected.
+
+		// REFERENCES:
+		// na
+
+		// FLOW:
+		std::ifstream CheckpointFile( FileName, std::ios::binary );
+		if ( ! CheckpointFile ) {
+			ShowSevereError( "ReadHeatBalanceCheckpoint: Could not open file \"" + FileName + "\" for input (read)." );
+			ErrorsFound = true;
+			return;
+		}
+		if ( ! ReadCheckpointHeader( CheckpointFile, HeatBalanceCheckpointMagic ) ) {
+			ShowSevereError( "ReadHeatBalanceCheckpoint: File \"" + FileName + "\" is not a heat balance checkpoint of this version or was written for a different input." );
+			ErrorsFound = true;
+			return;
+		}
+
+		if ( ! ReadCheckpointState( CheckpointFile, State ) || CheckpointFile.peek() != std::ifstream::traits_type::eof() ) {
+			ShowSevereError( "ReadHeatBalanceCheckpoint: File \"" + FileName + "\" is incomplete or was written for a different input." );
+			ErrorsFound = true;
+		}
+
+	}
+
+	void
+	WriteCheckpointState(
+		std::ofstream & CheckpointFile, // Open checkpoint file, header written
+		HeatBalanceCheckpoint const & State // State to write
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the arrays and green roof scalars of a checkpoint after the file header; shared by
+		// checkpoint files and surface heat balance capture files.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1D< Real64 > Scalars( HeatBalanceCheckpointNumScalars ); // Green roof state
+
+		// FLOW:
+		Scalars( 1 ) = State.SoilMoisture;
+		Scalars( 2 ) = State.RootMoisture;
+		Scalars( 3 ) = State.LeafTempPrev;
+		Scalars( 4 ) = State.GroundTempPrev;
+		Scalars( 5 ) = State.LeafVaporFlux;
+		Scalars( 6 ) = State.GroundVaporFlux;
+		Scalars( 7 ) = State.PlantCoverSoilMoisture;
+		Scalars( 8 ) = State.PlantCoverRootMoisture;
+		Scalars( 9 ) = State.PlantCoverLeafVaporFlux;
+		Scalars( 10 ) = State.PlantCoverGroundVaporFlux;
+		Scalars( 11 ) = State.PlantTemp;
+		Scalars( 12 ) = State.SoilTemp;
+		Scalars( 13 ) = State.BareSoilTemp;
+		Scalars( 14 ) = State.AvgSoilTemp;
+		Scalars( 15 ) = State.CumRunoff;
+		Scalars( 16 ) = State.CumET;
+		Scalars( 17 ) = State.CumPrecip;
+		Scalars( 18 ) = State.CumIrrigation;
+
+		WriteCheckpointArray( CheckpointFile, State.TH );
+		WriteCheckpointArray( CheckpointFile, State.QH );
+		WriteCheckpointArray( CheckpointFile, State.THM );
+		WriteCheckpointArray( CheckpointFile, State.QHM );
+		WriteCheckpointArray( CheckpointFile, State.TsrcHist );
+		WriteCheckpointArray( CheckpointFile, State.QsrcHist );
+		WriteCheckpointArray( CheckpointFile, State.TsrcHistM );
+		WriteCheckpointArray( CheckpointFile, State.QsrcHistM );
+		WriteCheckpointArray( CheckpointFile, State.SUMH );
+		WriteCheckpointArray( CheckpointFile, State.SumTime );
+		WriteCheckpointArray( CheckpointFile, State.QExt1 );
+		WriteCheckpointArray( CheckpointFile, State.QInt1 );
+		WriteCheckpointArray( CheckpointFile, State.TempExt1 );
+		WriteCheckpointArray( CheckpointFile, State.TempInt1 );
+		WriteCheckpointArray( CheckpointFile, State.Qsrc1 );
+		WriteCheckpointArray( CheckpointFile, State.Tsrc1 );
+		WriteCheckpointArray( CheckpointFile, State.TempSurfIn );
+		WriteCheckpointArray( CheckpointFile, State.TempSurfInTmp );
+		WriteCheckpointArray( CheckpointFile, State.TempSurfOut );
+		WriteCheckpointArray( CheckpointFile, State.TempInsOld );
+		WriteCheckpointArray( CheckpointFile, State.RefAirTemp );
+		WriteCheckpointArray( CheckpointFile, State.HConvInEvalDelTemp );
+		WriteCheckpointArray( CheckpointFile, State.MAT );
+		WriteCheckpointArray( CheckpointFile, State.ZT );
+		WriteCheckpointArray( CheckpointFile, State.ZTAV );
+		WriteCheckpointArray( CheckpointFile, State.XMAT );
+		WriteCheckpointArray( CheckpointFile, State.XM2T );
+		WriteCheckpointArray( CheckpointFile, State.XM3T );
+		WriteCheckpointArray( CheckpointFile, State.XM4T );
+		WriteCheckpointArray( CheckpointFile, State.XMPT );
+		WriteCheckpointArray( CheckpointFile, State.ZoneTMX );
+		WriteCheckpointArray( CheckpointFile, State.ZoneTM2 );
+		WriteCheckpointArray( CheckpointFile, State.ZoneAirHumRat );
+		WriteCheckpointArray( CheckpointFile, State.ZoneAirHumRatAvg );
+		WriteCheckpointArray( CheckpointFile, State.ZoneAirHumRatOld );
+		WriteCheckpointArray( CheckpointFile, Scalars );
+
+	}
+
+	bool
+	ReadCheckpointState(
+		std::ifstream & CheckpointFile, // Open checkpoint file, header read
+		HeatBalanceCheckpoint & State // State read from the file
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads what WriteCheckpointState wrote; false if an array does not match the current
+		// simulation's arrays or the file ends early.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		FArray1D< Real64 > Scalars( HeatBalanceCheckpointNumScalars ); // Green roof state
+		bool ReadOK; // False once any array failed to read
+
+		// FLOW:
+		State.TH.dimension( TH );
+		State.QH.dimension( QH );
+		State.THM.dimension( THM );
+		State.QHM.dimension( QHM );
+		State.TsrcHist.dimension( TsrcHist );
+		State.QsrcHist.dimension( QsrcHist );
+		State.TsrcHistM.dimension( TsrcHistM );
+		State.QsrcHistM.dimension( QsrcHistM );
+		State.SUMH.dimension( SUMH );
+		State.SumTime.dimension( SumTime );
+		State.QExt1.dimension( QExt1 );
+		State.QInt1.dimension( QInt1 );
+		State.TempExt1.dimension( TempExt1 );
+		State.TempInt1.dimension( TempInt1 );
+		State.Qsrc1.dimension( Qsrc1 );
+		State.Tsrc1.dimension( Tsrc1 );
+		State.TempSurfIn.dimension( TempSurfIn );
+		State.TempSurfInTmp.dimension( TempSurfInTmp );
+		State.TempSurfOut.dimension( TempSurfOut );
+		State.TempInsOld.dimension( TempInsOld );
+		State.RefAirTemp.dimension( RefAirTemp );
+		State.HConvInEvalDelTemp.dimension( HConvInEvalDelTemp );
+		State.MAT.dimension( MAT );
+		State.ZT.dimension( ZT );
+		State.ZTAV.dimension( ZTAV );
+		State.XMAT.dimension( XMAT );
+		State.XM2T.dimension( XM2T );
+		State.XM3T.dimension( XM3T );
+		State.XM4T.dimension( XM4T );
+		State.XMPT.dimension( XMPT );
+		State.ZoneTMX.dimension( ZoneTMX );
+		State.ZoneTM2.dimension( ZoneTM2 );
+		State.ZoneAirHumRat.dimension( ZoneAirHumRat );
+		State.ZoneAirHumRatAvg.dimension( ZoneAirHumRatAvg );
+		State.ZoneAirHumRatOld.dimension( ZoneAirHumRatOld );
+
+		ReadOK = ReadCheckpointArray( CheckpointFile, State.TH );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.QH );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.THM );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.QHM );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.TsrcHist );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.QsrcHist );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.TsrcHistM );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.QsrcHistM );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.SUMH );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.SumTime );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.QExt1 );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.QInt1 );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.TempExt1 );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.TempInt1 );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.Qsrc1 );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.Tsrc1 );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.TempSurfIn );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.TempSurfInTmp );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.TempSurfOut );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.TempInsOld );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.RefAirTemp );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.HConvInEvalDelTemp );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.MAT );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.ZT );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.ZTAV );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.XMAT );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.XM2T );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.XM3T );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.XM4T );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.XMPT );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.ZoneTMX );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.ZoneTM2 );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.ZoneAirHumRat );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.ZoneAirHumRatAvg );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, State.ZoneAirHumRatOld );
+		ReadOK = ReadOK && ReadCheckpointArray( CheckpointFile, Scalars );
+		if ( ! ReadOK ) return false;
+
+		State.SoilMoisture = Scalars( 1 );
+		State.RootMoisture = Scalars( 2 );
+		State.LeafTempPrev = Scalars( 3 );
+		State.GroundTempPrev = Scalars( 4 );
+		State.LeafVaporFlux = Scalars( 5 );
+		State.GroundVaporFlux = Scalars( 6 );
+		State.PlantCoverSoilMoisture = Scalars( 7 );
+		State.PlantCoverRootMoisture = Scalars( 8 );
+		State.PlantCoverLeafVaporFlux = Scalars( 9 );
+		State.PlantCoverGroundVaporFlux = Scalars( 10 );
+		State.PlantTemp = Scalars( 11 );
+		State.SoilTemp = Scalars( 12 );
+		State.BareSoilTemp = Scalars( 13 );
+		State.AvgSoilTemp = Scalars( 14 );
+		State.CumRunoff = Scalars( 15 );
+		State.CumET = Scalars( 16 );
+		State.CumPrecip = Scalars( 17 );
+		State.CumIrrigation = Scalars( 18 );
+		return true;
+
+	}
+
+	void
+	WriteCheckpointHeader(
+		std::ofstream & CheckpointFile, // Open checkpoint file
+		std::string const & Magic, // HeatBalanceCheckpointMagic or SurfaceHeatBalanceCaptureMagic
+		HeatBalanceCheckpoint const & State // State about to be written
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the header of a checkpoint file: magic, layout version, the numbers of array and
+		// scalar members of HeatBalanceCheckpoint, and the numbers of surfaces, zones and CTF terms
+		// of the state.
+
+		// FLOW:
+		std::int32_t const Header[ 6 ] = { std::int32_t( HeatBalanceCheckpointVersion ), std::int32_t( HeatBalanceCheckpointNumArrays ), std::int32_t( HeatBalanceCheckpointNumScalars ), std::int32_t( State.TH.isize1() ), std::int32_t( State.MAT.isize1() ), std::int32_t( State.TH.isize2() ) };
+		CheckpointFile.write( Magic.data(), Magic.size() );
+		CheckpointFile.write( reinterpret_cast< char const * >( Header ), sizeof( Header ) );
+
+	}
+
+	bool
+	ReadCheckpointHeader(
+		std::ifstream & CheckpointFile, // Open checkpoint file
+		std::string const & Magic // Magic the file must start with
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads the header written by WriteCheckpointHeader; false unless the magic, version and
+		// member counts match and the file has the surfaces, zones and CTF terms of the current
+		// simulation.
+
+		// FLOW:
+		std::string FileMagic( Magic.size(), ' ' );
+		std::int32_t Header[ 6 ] = { 0, 0, 0, 0, 0, 0 };
+		CheckpointFile.read( &FileMagic[ 0 ], FileMagic.size() );
+		CheckpointFile.read( reinterpret_cast< char * >( Header ), sizeof( Header ) );
+		if ( ! CheckpointFile || FileMagic != Magic ) return false;
+		if ( Header[ 0 ] != HeatBalanceCheckpointVersion || Header[ 1 ] != HeatBalanceCheckpointNumArrays || Header[ 2 ] != HeatBalanceCheckpointNumScalars ) return false;
+		return ( Header[ 3 ] == TH.isize1() && Header[ 4 ] == MAT.isize1() && Header[ 5 ] == TH.isize2() );
+
+	}
+
+	void
+	WriteCheckpointArray(
+		std::ofstream & CheckpointFile, // Open checkpoint file
+		FArray< Real64 > const & Values // Array to write
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the element count, as a 64-bit integer so the file does not depend on the platform's
+		// size_t, and the elements (storage order) of one checkpoint array.
+
+		// FLOW:
+		std::int64_t const NumValues( Values.size() );
+		CheckpointFile.write( reinterpret_cast< char const * >( &NumValues ), sizeof( NumValues ) );
+		for ( std::int64_t i = 0; i < NumValues; ++i ) {
+			Real64 const Value( Values[ i ] );
+			CheckpointFile.write( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+		}
+
+	}
+
+	void
+	WriteCheckpointArray(
+		std::ofstream & CheckpointFile, // Open checkpoint file
+		FArray< int > const & Values // Array to write
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Integer version of WriteCheckpointArray; elements are stored as 32-bit integers.
+
+		// FLOW:
+		std::int64_t const NumValues( Values.size() );
+		CheckpointFile.write( reinterpret_cast< char const * >( &NumValues ), sizeof( NumValues ) );
+		for ( std::int64_t i = 0; i < NumValues; ++i ) {
+			std::int32_t const Value( Values[ i ] );
+			CheckpointFile.write( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+		}
+
+	}
+
+	bool
+	ReadCheckpointArray(
+		std::ifstream & CheckpointFile, // Open checkpoint file
+		FArray< Real64 > & Values // Dimensioned array to read into
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads one array written by WriteCheckpointArray; false if the element count differs
+		// from the size of Values or the file ends early.
+
+		// FLOW:
+		std::int64_t NumValues( 0 );
+		CheckpointFile.read( reinterpret_cast< char * >( &NumValues ), sizeof( NumValues ) );
+		if ( ! CheckpointFile || NumValues != std::int64_t( Values.size() ) ) return false;
+		for ( std::int64_t i = 0; i < NumValues; ++i ) {
+			Real64 Value;
+			CheckpointFile.read( reinterpret_cast< char * >( &Value ), sizeof( Value ) );
+			Values[ i ] = Value;
+		}
+		return bool( CheckpointFile );
+
+	}
+
+	bool
+	ReadCheckpointArray(
+		std::ifstream & CheckpointFile, // Open checkpoint file
+		FArray< int > & Values // Dimensioned array to read into
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Integer version of ReadCheckpointArray.
+
+		// FLOW:
+		std::int64_t NumValues( 0 );
+		CheckpointFile.read( reinterpret_cast< char * >( &NumValues ), sizeof( NumValues ) );
+		if ( ! CheckpointFile || NumValues != std::int64_t( Values.size() ) ) return false;
+		for ( std::int64_t i = 0; i < NumValues; ++i ) {
+			std::int32_t Value;
+			CheckpointFile.read( reinterpret_cast< char * >( &Value ), sizeof( Value ) );
+			Values[ i ] = Value;
+		}
+		return bool( CheckpointFile );
+
+	}
+
+	void
+	CaptureSurfaceHeatBalance( SurfaceHeatBalanceCapture & Capture ) // Capture filled from the current timestep
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Takes everything CalcHeatBalanceOutsideSurf and CalcHeatBalanceInsideSurf read that
+		// changes from timestep to timestep, so that ReplaySurfaceHeatBalance can re-execute them.
+
+		// METHODOLOGY EMPLOYED:
+		// Called after InitSurfaceHeatBalance and before the surface heat balances.  Surface,
+		// construction and material tables and schedule values are not copied; a capture is
+		// replayed at the same zone timestep of a run of the same input (StartSurfaceHeatBalanceCapture).
+		// The face temperatures the timestep produces are added by FinishSurfaceHeatBalanceCapture.
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum; // Surface number DO loop counter
+
+		// FLOW:
+		CaptureHeatBalanceCheckpoint( Capture.State );
+		Capture.CTFConstOutPart = CTFConstOutPart;
+		Capture.CTFConstInPart = CTFConstInPart;
+		Capture.QRadSWOutAbs = QRadSWOutAbs;
+		Capture.QRadSWInAbs = QRadSWInAbs;
+		Capture.QRadThermInAbs = QRadThermInAbs;
+		Capture.QRadSWOutMvIns = QRadSWOutMvIns;
+		Capture.HConvIn = HConvIn;
+		Capture.TempEffBulkAir = TempEffBulkAir;
+		Capture.QRadSWwinAbs = QRadSWwinAbs;
+		Capture.SurfOutDryBulbTemp.dimension( TotSurfaces );
+		Capture.SurfOutWetBulbTemp.dimension( TotSurfaces );
+		Capture.SurfWindSpeed.dimension( TotSurfaces );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			Capture.SurfOutDryBulbTemp( SurfNum ) = Surface( SurfNum ).OutDryBulbTemp;
+			Capture.SurfOutWetBulbTemp( SurfNum ) = Surface( SurfNum ).OutWetBulbTemp;
+			Capture.SurfWindSpeed( SurfNum ) = Surface( SurfNum ).WindSpeed;
+		}
+		Capture.TempSurfInHist = TempSurfInHist;
+		Capture.NumTempSurfInHist = NumTempSurfInHist;
+		Capture.TempSurfInPredictPending = TempSurfInPredictPending;
+		Capture.NetLWRadToSurf = NetLWRadToSurf;
+		Capture.OutDryBulbTemp = OutDryBulbTemp;
+		Capture.OutWetBulbTemp = OutWetBulbTemp;
+		Capture.OutHumRat = OutHumRat;
+		Capture.OutBaroPress = OutBaroPress;
+		Capture.WindSpeed = WindSpeed;
+		Capture.WindDir = WindDir;
+		Capture.SkyTemp = SkyTemp;
+		Capture.BeamSolarRad = BeamSolarRad;
+		Capture.DifSolarRad = DifSolarRad;
+		Capture.IsRain = IsRain;
+
+	}
+
+	void
+	RestoreSurfaceHeatBalance( SurfaceHeatBalanceCapture const & Capture ) // Capture to make current
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Makes a capture taken by CaptureSurfaceHeatBalance the current surface heat balance input.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum; // Surface number DO loop counter
+
+		// FLOW:
+		RestoreHeatBalanceCheckpoint( Capture.State );
+		CTFConstOutPart = Capture.CTFConstOutPart;
+		CTFConstInPart = Capture.CTFConstInPart;
+		QRadSWOutAbs = Capture.QRadSWOutAbs;
+		QRadSWInAbs = Capture.QRadSWInAbs;
+		QRadThermInAbs = Capture.QRadThermInAbs;
+		QRadSWOutMvIns = Capture.QRadSWOutMvIns;
+		HConvIn = Capture.HConvIn;
+		TempEffBulkAir = Capture.TempEffBulkAir;
+		QRadSWwinAbs = Capture.QRadSWwinAbs;
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			Surface( SurfNum ).OutDryBulbTemp = Capture.SurfOutDryBulbTemp( SurfNum );
+			Surface( SurfNum ).OutWetBulbTemp = Capture.SurfOutWetBulbTemp( SurfNum );
+			Surface( SurfNum ).WindSpeed = Capture.SurfWindSpeed( SurfNum );
+		}
+		TempSurfInHist = Capture.TempSurfInHist;
+		NumTempSurfInHist = Capture.NumTempSurfInHist;
+		TempSurfInPredictPending = Capture.TempSurfInPredictPending;
+		NetLWRadToSurf = Capture.NetLWRadToSurf;
+		OutDryBulbTemp = Capture.OutDryBulbTemp;
+		OutWetBulbTemp = Capture.OutWetBulbTemp;
+		OutHumRat = Capture.OutHumRat;
+		OutBaroPress = Capture.OutBaroPress;
+		WindSpeed = Capture.WindSpeed;
+		WindDir = Capture.WindDir;
+		SkyTemp = Capture.SkyTemp;
+		BeamSolarRad = Capture.BeamSolarRad;
+		DifSolarRad = Capture.DifSolarRad;
+		IsRain = Capture.IsRain;
+
+	}
+
+	void
+	WriteSurfaceHeatBalanceCapture(
+		SurfaceHeatBalanceCapture const & Capture, // Capture to write
+		std::string const & FileName // Capture file
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes a surface heat balance capture, including its reference face temperatures, to a file.
+
+		// METHODOLOGY EMPLOYED:
+		// Checkpoint file layout (WriteHeatBalanceCheckpoint) with SurfaceHeatBalanceCaptureMagic in
+		// the header: the checkpoint state, then the other captured arrays, the weather and inside
+		// face temperature predictor scalars, and the reference face temperatures and long-wave
+		// radiation, each as element count and elements.
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1D< Real64 > Scalars( 12 ); // Weather and inside face temperature predictor state
+
+		// FLOW:
+		std::ofstream CaptureFile( FileName, std::ios::binary );
+		if ( ! CaptureFile ) {
+			ShowFatalError( "WriteSurfaceHeatBalanceCapture: Could not open file \"" + FileName + "\" for output (write)." );
+		}
+
+		Scalars( 1 ) = Capture.OutDryBulbTemp;
+		Scalars( 2 ) = Capture.OutWetBulbTemp;
+		Scalars( 3 ) = Capture.OutHumRat;
+		Scalars( 4 ) = Capture.OutBaroPress;
+		Scalars( 5 ) = Capture.WindSpeed;
+		Scalars( 6 ) = Capture.WindDir;
+		Scalars( 7 ) = Capture.SkyTemp;
+		Scalars( 8 ) = Capture.BeamSolarRad;
+		Scalars( 9 ) = Capture.DifSolarRad;
+		Scalars( 10 ) = ( Capture.IsRain ? 1.0 : 0.0 );
+		Scalars( 11 ) = Capture.NumTempSurfInHist;
+		Scalars( 12 ) = ( Capture.TempSurfInPredictPending ? 1.0 : 0.0 );
+
+		WriteCheckpointHeader( CaptureFile, SurfaceHeatBalanceCaptureMagic, Capture.State );
+		WriteCheckpointState( CaptureFile, Capture.State );
+		WriteCheckpointArray( CaptureFile, Capture.CTFConstOutPart );
+		WriteCheckpointArray( CaptureFile, Capture.CTFConstInPart );
+		WriteCheckpointArray( CaptureFile, Capture.QRadSWOutAbs );
+		WriteCheckpointArray( CaptureFile, Capture.QRadSWInAbs );
+		WriteCheckpointArray( CaptureFile, Capture.QRadThermInAbs );
+		WriteCheckpointArray( CaptureFile, Capture.QRadSWOutMvIns );
+		WriteCheckpointArray( CaptureFile, Capture.HConvIn );
+		WriteCheckpointArray( CaptureFile, Capture.TempEffBulkAir );
+		WriteCheckpointArray( CaptureFile, Capture.QRadSWwinAbs );
+		WriteCheckpointArray( CaptureFile, Capture.SurfOutDryBulbTemp );
+		WriteCheckpointArray( CaptureFile, Capture.SurfOutWetBulbTemp );
+		WriteCheckpointArray( CaptureFile, Capture.SurfWindSpeed );
+		WriteCheckpointArray( CaptureFile, Capture.TempSurfInHist );
+		WriteCheckpointArray( CaptureFile, Capture.NetLWRadToSurf );
+		WriteCheckpointArray( CaptureFile, Scalars );
+		WriteCheckpointArray( CaptureFile, Capture.TempSurfInRef );
+		WriteCheckpointArray( CaptureFile, Capture.TempSurfOutRef );
+		WriteCheckpointArray( CaptureFile, Capture.NetLWRadToSurfRef );
+
+		CaptureFile.close();
+		if ( CaptureFile.fail() ) {
+			ShowFatalError( "WriteSurfaceHeatBalanceCapture: Error writing file \"" + FileName + "\"." );
+		}
+
+	}
+
+	void
+	ReadSurfaceHeatBalanceCapture(
+		std::string const & FileName, // Capture file
+		SurfaceHeatBalanceCapture & Capture, // Capture read from the file
+		bool & ErrorsFound // Set to true if the file cannot be read or does not match this input
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads a capture written by WriteSurfaceHeatBalanceCapture.
+
+		// METHODOLOGY EMPLOYED:
+		// As ReadHeatBalanceCheckpoint: the header must match the current simulation, the arrays are
+		// dimensioned like the current simulation's arrays, and a file whose element counts differ,
+		// that ends early or that has data left over is rejected.
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1D< Real64 > Scalars( 12 ); // Weather and inside face temperature predictor state
+		bool ReadOK; // False once any array failed to read
+
+		// FLOW:
+		std::ifstream CaptureFile( FileName, std::ios::binary );
+		if ( ! CaptureFile ) {
+			ShowSevereError( "ReadSurfaceHeatBalanceCapture: Could not open file \"" + FileName + "\" for input (read)." );
+			ErrorsFound = true;
+			return;
+		}
+		if ( ! ReadCheckpointHeader( CaptureFile, SurfaceHeatBalanceCaptureMagic ) ) {
+			ShowSevereError( "ReadSurfaceHeatBalanceCapture: File \"" + FileName + "\" is not a surface heat balance capture of this version or was written for a different input." );
+			ErrorsFound = true;
+			return;
+		}
+
+		Capture.CTFConstOutPart.dimension( CTFConstOutPart );
+		Capture.CTFConstInPart.dimension( CTFConstInPart );
+		Capture.QRadSWOutAbs.dimension( QRadSWOutAbs );
+		Capture.QRadSWInAbs.dimension( QRadSWInAbs );
+		Capture.QRadThermInAbs.dimension( QRadThermInAbs );
+		Capture.QRadSWOutMvIns.dimension( QRadSWOutMvIns );
+		Capture.HConvIn.dimension( HConvIn );
+		Capture.TempEffBulkAir.dimension( TempEffBulkAir );
+		Capture.QRadSWwinAbs.dimension( QRadSWwinAbs );
+		Capture.SurfOutDryBulbTemp.dimension( TotSurfaces );
+		Capture.SurfOutWetBulbTemp.dimension( TotSurfaces );
+		Capture.SurfWindSpeed.dimension( TotSurfaces );
+		Capture.TempSurfInHist.dimension( TempSurfInHist );
+		Capture.NetLWRadToSurf.dimension( NetLWRadToSurf );
+		Capture.TempSurfInRef.dimension( TempSurfIn );
+		Capture.TempSurfOutRef.dimension( TempSurfOut );
+		Capture.NetLWRadToSurfRef.dimension( NetLWRadToSurf );
+
+		ReadOK = ReadCheckpointState( CaptureFile, Capture.State );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.CTFConstOutPart );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.CTFConstInPart );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.QRadSWOutAbs );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.QRadSWInAbs );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.QRadThermInAbs );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.QRadSWOutMvIns );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.HConvIn );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.TempEffBulkAir );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.QRadSWwinAbs );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.SurfOutDryBulbTemp );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.SurfOutWetBulbTemp );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.SurfWindSpeed );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.TempSurfInHist );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.NetLWRadToSurf );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Scalars );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.TempSurfInRef );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.TempSurfOutRef );
+		ReadOK = ReadOK && ReadCheckpointArray( CaptureFile, Capture.NetLWRadToSurfRef );
+		ReadOK = ReadOK && CaptureFile.peek() == std::ifstream::traits_type::eof();
+		if ( ! ReadOK ) {
+			ShowSevereError( "ReadSurfaceHeatBalanceCapture: File \"" + FileName + "\" is incomplete or was written for a different input." );
+			ErrorsFound = true;
+			return;
+		}
+
+		Capture.OutDryBulbTemp = Scalars( 1 );
+		Capture.OutWetBulbTemp = Scalars( 2 );
+		Capture.OutHumRat = Scalars( 3 );
+		Capture.OutBaroPress = Scalars( 4 );
+		Capture.WindSpeed = Scalars( 5 );
+		Capture.WindDir = Scalars( 6 );
+		Capture.SkyTemp = Scalars( 7 );
+		Capture.BeamSolarRad = Scalars( 8 );
+		Capture.DifSolarRad = Scalars( 9 );
+		Capture.IsRain = ( Scalars( 10 ) != 0.0 );
+		Capture.NumTempSurfInHist = int( Scalars( 11 ) );
+		Capture.TempSurfInPredictPending = ( Scalars( 12 ) != 0.0 );
+
+	}
+
+	bool
+	IsSurfaceHeatBalanceCaptureStep()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// True at the zone timestep chosen by Output:SurfaceHeatBalanceCapture: the first one outside
+		// sizing and warmup with the chosen day of simulation, hour and time step.
+
+		// FLOW:
+		if ( SurfaceCaptureDone || DoingSizing || WarmupFlag ) return false;
+		return ( DayOfSim == SurfaceCaptureDay && HourOfDay == SurfaceCaptureHour && TimeStep == SurfaceCaptureTimeStep );
+
+	}
+
+	void
+	StartSurfaceHeatBalanceCapture()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Called by ManageSurfaceHeatBalance before the surface heat balances of the capture timestep.
+		// Capture mode takes the inputs; Replay mode reads the capture file and replays it.
+
+		// METHODOLOGY EMPLOYED:
+		// A replay leaves the simulation as it was: the current inputs are kept in a second capture
+		// and restored afterwards, so the timestep then runs normally whatever the replay found.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		SurfaceHeatBalanceCapture Current; // Inputs of this timestep, kept across the replay
+		bool ErrorsFound( false ); // Set if the capture file cannot be read
+		bool BitIdentical; // True if every repetition reproduced the captured face temperatures
+		Real64 MaxTempDiff; // Largest face temperature difference from the capture [deltaC]
+		Real64 NsPerSurface; // Time of one outside plus inside heat balance per surface [ns]
+
+		// FLOW:
+		if ( SurfaceCaptureMode == SurfaceCaptureWrite ) {
+			CaptureSurfaceHeatBalance( SurfaceCapture );
+			return;
+		}
+
+		ReadSurfaceHeatBalanceCapture( SurfaceCaptureFileName, SurfaceCapture, ErrorsFound );
+		if ( ErrorsFound ) ShowFatalError( "StartSurfaceHeatBalanceCapture: Cannot replay Output:SurfaceHeatBalanceCapture file \"" + SurfaceCaptureFileName + "\"." );
+		CaptureSurfaceHeatBalance( Current );
+		ReplaySurfaceHeatBalance( SurfaceCapture, SurfaceCaptureRepetitions, BitIdentical, MaxTempDiff, NsPerSurface );
+		RestoreSurfaceHeatBalance( Current );
+		if ( ! BitIdentical ) {
+			ShowWarningError( "Output:SurfaceHeatBalanceCapture: The replay of \"" + SurfaceCaptureFileName + "\" did not reproduce the captured face temperatures." );
+			ShowContinueError( "...Largest difference=[" + RoundSigDigits( MaxTempDiff, 6 ) + "] deltaC." );
+		}
+		SurfaceCaptureDone = true;
+
+	}
+
+	void
+	FinishSurfaceHeatBalanceCapture()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Called by ManageSurfaceHeatBalance after the surface heat balances of the capture timestep in
+		// Capture mode: adds the face temperatures they produced to the capture and writes it.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// FLOW:
+		SurfaceCapture.TempSurfInRef = TempSurfIn;
+		SurfaceCapture.TempSurfOutRef = TempSurfOut;
+		SurfaceCapture.NetLWRadToSurfRef = NetLWRadToSurf;
+		WriteSurfaceHeatBalanceCapture( SurfaceCapture, SurfaceCaptureFileName );
+		SurfaceCaptureDone = true;
+
+	}
+
+	void
+	ReplaySurfaceHeatBalance(
+		SurfaceHeatBalanceCapture const & Capture, // Captured inputs and face temperatures of a surface heat balance
+		int const NumRepeats, // Number of times the surface heat balance is repeated
+		bool & BitIdentical, // True if every repetition reproduced the captured face temperatures and long-wave radiation
+		Real64 & MaxTempDiff, // Largest face temperature difference of the first repetition that differs [deltaC]
+		Real64 & NsPerSurface // Average time of one outside plus inside heat balance per surface [ns]
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Benchmarks and regression-tests the surface heat balance in isolation: re-executes
+		// CalcHeatBalanceOutsideSurf and CalcHeatBalanceInsideSurf from the captured inputs and
+		// checks that every repetition gives the face temperatures and net interior long-wave
+		// radiation of the captured timestep bit for bit.
+
+		// METHODOLOGY EMPLOYED:
+		// Each repetition restores the capture first, so all repetitions solve the same problem;
+		// only the two heat balance calls are timed.  Once a repetition differs, the later ones are
+		// timed but not compared.  The result is written to the initialization
+		// output file.  The capture is restored on exit and the inside surface iteration
+		// statistics are left as they were.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool FirstWrite( true );
+		int Repeat; // Repetition counter
+		std::chrono::steady_clock::duration SolveTime( std::chrono::steady_clock::duration::zero() ); // Time in the heat balances
+		Real64 const SavedIterSum( InsideSurfIterSum );
+		int const SavedSolveCount( InsideSurfSolveCount );
+		int const SavedFallbackSum( InsideSurfFallbackSum );
+
+		// Formats
+		static gio::Fmt Format_720( "('! <Surface Heat Balance Replay>, Repetitions, Surfaces, Bit Identical, Max Face Temperature Difference {deltaC}, Time per Surface {ns}')" );
+		static gio::Fmt Format_721( "(' Surface Heat Balance Replay',5(',',A))" );
+
+		// FLOW:
+		BitIdentical = true;
+		MaxTempDiff = 0.0;
+		NsPerSurface = 0.0;
+		if ( NumRepeats <= 0 || TotSurfaces == 0 ) return;
+		assert( Capture.TempSurfInRef.size() == TempSurfIn.size() && Capture.TempSurfOutRef.size() == TempSurfOut.size() && Capture.NetLWRadToSurfRef.size() == NetLWRadToSurf.size() );
+
+		for ( Repeat = 1; Repeat <= NumRepeats; ++Repeat ) {
+			RestoreSurfaceHeatBalance( Capture );
+			auto const StartTime( std::chrono::steady_clock::now() );
+			CalcHeatBalanceOutsideSurf();
+			CalcHeatBalanceInsideSurf();
+			SolveTime += std::chrono::steady_clock::now() - StartTime;
+			if ( BitIdentical ) {
+				for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+					if ( TempSurfIn( SurfNum ) != Capture.TempSurfInRef( SurfNum ) || TempSurfOut( SurfNum ) != Capture.TempSurfOutRef( SurfNum ) || NetLWRadToSurf( SurfNum ) != Capture.NetLWRadToSurfRef( SurfNum ) ) {
+						BitIdentical = false;
+						MaxTempDiff = max( MaxTempDiff, std::abs( TempSurfIn( SurfNum ) - Capture.TempSurfInRef( SurfNum ) ), std::abs( TempSurfOut( SurfNum ) - Capture.TempSurfOutRef( SurfNum ) ) );
+					}
+				}
+			}
+		}
+
+		NsPerSurface = std::chrono::duration< Real64, std::nano >( SolveTime ).count() / ( double( NumRepeats ) * double( TotSurfaces ) );
+		RestoreSurfaceHeatBalance( Capture );
+		InsideSurfIterSum = SavedIterSum;
+		InsideSurfSolveCount = SavedSolveCount;
+		InsideSurfFallbackSum = SavedFallbackSum;
+
+		if ( FirstWrite ) {
+			gio::write( OutputFileInits, Format_720 );
+			FirstWrite = false;
+		}
+		gio::write( OutputFileInits, Format_721 ) << RoundSigDigits( NumRepeats ) << RoundSigDigits( TotSurfaces ) << ( BitIdentical ? "Yes" : "No" ) << RoundSigDigits( MaxTempDiff, 6 ) << RoundSigDigits( NsPerSurface, 1 );
+
+	}
+
+	void
+	CalculateZoneMRT( Optional_int_const ZoneToResimulate ) // if passed in, then only calculate surfaces that have this zone
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Rick Strand
+		//       DATE WRITTEN   November 2000
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the current zone MRT for thermal comfort and radiation
+		// calculation purposes.
+
+		// METHODOLOGY EMPLOYED:
+		// If you have to ask...
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool firstTime( true ); // Flag for first time calculations
+		Real64 SumAET; // Intermediate calculational variable (area*emissivity*T) sum
+		static FArray1D< Real64 > SurfaceAE; // Product of area and emissivity for each surface
+		int SurfNum; // Surface number
+		static FArray1D< Real64 > ZoneAESum; // Sum of area times emissivity for all zone surfaces
+		int ZoneNum; // Zone number
+
+		// FLOW:
+		if ( firstTime ) {
+			SurfaceAE.allocate( TotSurfaces );
+			ZoneAESum.allocate( NumOfZones );
+			SurfaceAE = 0.0;
+			ZoneAESum = 0.0;
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( Surface( SurfNum ).HeatTransSurf ) {
+					SurfaceAE( SurfNum ) = Surface( SurfNum ).Area * Construct( Surface( SurfNum ).Construction ).InsideAbsorpThermal;
+					ZoneNum = Surface( SurfNum ).Zone;
+					if ( ZoneNum > 0 ) ZoneAESum( ZoneNum ) += SurfaceAE( SurfNum );
+				}
+			}
+		}
+
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( present( ZoneToResimulate ) && ( ZoneNum != ZoneToResimulate ) ) continue;
+			SumAET = 0.0;
+			for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+				if ( Surface( SurfNum ).HeatTransSurf ) {
+					SumAET += SurfaceAE( SurfNum ) * TempSurfIn( SurfNum );
+				}
+			}
+			if ( ZoneAESum( ZoneNum ) > 0.01 ) {
+				MRT( ZoneNum ) = SumAET / ZoneAESum( ZoneNum );
+			} else {
+				if ( firstTime ) {
+					ShowWarningError( "Zone areas*inside surface emissivities are summing to zero, for Zone=\"" + Zone( ZoneNum ).Name + "\"" );
+					ShowContinueError( "As a result, MRT will be set to MAT for that zone" );
+				}
+				MRT( ZoneNum ) = MAT( ZoneNum );
+			}
+		}
+
+		firstTime = false;
+
+	}
+
+	// End of Record Keeping subroutines for the HB Module
+	// *****************************************************************************
+
+	// Beginning of Reporting subroutines for the HB Module
+	// *****************************************************************************
+
+	void
+	ReportSurfaceHeatBalance()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Linda Lawrie
+		//       DATE WRITTEN   Oct 2000
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine puts the reporting part of the HBSurface Module in one area.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using SolarShading::ReportSurfaceShading;
+		using OutputReportTabular::lightSWRadSeq;
+		using OutputReportTabular::feneSolarRadSeq;
+		using DataGlobals::NumOfTimeStepInHour;
+		using DataGlobals::CompLoadReportIsReq;
+		using DataGlobals::isPulseZoneSizing;
+		using DataSizing::CurOverallSimDay;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum;
+		int ZoneNum;
+		static int TimeStepInDay( 0 );
+
+		ZoneMRT( {1,NumOfZones} ) = MRT( {1,NumOfZones} );
+
+		ReportSurfaceShading();
+
+		// update inside face radiation reports
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			QdotRadNetSurfInRep( SurfNum ) = NetLWRadToSurf( SurfNum ) * Surface( SurfNum ).Area;
+			QdotRadNetSurfInRepPerArea( SurfNum ) = NetLWRadToSurf( SurfNum );
+			QRadNetSurfInReport( SurfNum ) = QdotRadNetSurfInRep( SurfNum ) * SecInHour * TimeStepZone;
+
+			if ( Surface( SurfNum ).Class != SurfaceClass_Window ) { // not a window...
+				QdotRadSolarInRepPerArea( SurfNum ) = QRadSWInAbs( SurfNum ) - QRadSWLightsInAbs( SurfNum );
+				QdotRadSolarInRep( SurfNum ) = QdotRadSolarInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
+				QRadSolarInReport( SurfNum ) = QdotRadSolarInRep( SurfNum ) * SecInHour * TimeStepZone;
+
+				QdotRadLightsInRepPerArea( SurfNum ) = QRadSWLightsInAbs( SurfNum );
 				QdotRadLightsInRep( SurfNum ) = QdotRadLightsInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
 				QRadLightsInReport( SurfNum ) = QdotRadLightsInRep( SurfNum ) * SecInHour * TimeStepZone;
 
-				if ( ZoneSizingCalc && CompLoadReportIsReq ) {
-					TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
-					lightSWRadSeq( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotRadLightsInRep( SurfNum );
-					feneSolarRadSeq( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotRadSolarInRep( SurfNum );
+				if ( ZoneSizingCalc && CompLoadReportIsReq ) {
+					TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
+					lightSWRadSeq( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotRadLightsInRep( SurfNum );
+					feneSolarRadSeq( SurfNum, TimeStepInDay, CurOverallSimDay ) = QdotRadSolarInRep( SurfNum );
+				}
+			} else { // can we fill these for windows?
+
+			}
+
+			QdotRadIntGainsInRepPerArea( SurfNum ) = QRadThermInAbs( SurfNum );
+			QdotRadIntGainsInRep( SurfNum ) = QdotRadIntGainsInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
+			QRadIntGainsInReport( SurfNum ) = QdotRadIntGainsInRep( SurfNum ) * SecInHour * TimeStepZone;
+
+			QdotRadHVACInRepPerArea( SurfNum ) = QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum );
+			QdotRadHVACInRep( SurfNum ) = QdotRadHVACInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
+			QRadHVACInReport( SurfNum ) = QdotRadHVACInRep( SurfNum ) * SecInHour * TimeStepZone;
+
+			if ( Surface( SurfNum ).Class == SurfaceClass_Floor || Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_IntMass || Surface( SurfNum ).Class == SurfaceClass_Roof || Surface( SurfNum ).Class == SurfaceClass_Door ) {
+
+				// inside face conduction updates
+				OpaqSurfInsFaceConductionEnergy( SurfNum ) = OpaqSurfInsFaceConduction( SurfNum ) * SecInHour * TimeStepZone;
+				ZoneOpaqSurfInsFaceCond( Surface( SurfNum ).Zone ) += OpaqSurfInsFaceConduction( SurfNum );
+				OpaqSurfInsFaceCondGainRep( SurfNum ) = 0.0;
+				OpaqSurfInsFaceCondLossRep( SurfNum ) = 0.0;
+				if ( OpaqSurfInsFaceConduction( SurfNum ) >= 0.0 ) {
+					OpaqSurfInsFaceCondGainRep( SurfNum ) = OpaqSurfInsFaceConduction( SurfNum );
+				} else {
+					OpaqSurfInsFaceCondLossRep( SurfNum ) = -OpaqSurfInsFaceConduction( SurfNum );
+				}
+
+				// outside face conduction updates
+				OpaqSurfOutsideFaceConductionEnergy( SurfNum ) = OpaqSurfOutsideFaceConduction( SurfNum ) * SecInHour * TimeStepZone;
+				ZoneOpaqSurfExtFaceCond( Surface( SurfNum ).Zone ) += OpaqSurfOutsideFaceConduction( SurfNum );
+				OpaqSurfExtFaceCondGainRep( SurfNum ) = 0.0;
+				OpaqSurfExtFaceCondLossRep( SurfNum ) = 0.0;
+				if ( OpaqSurfOutsideFaceConduction( SurfNum ) >= 0.0 ) {
+					OpaqSurfExtFaceCondGainRep( SurfNum ) = OpaqSurfOutsideFaceConduction( SurfNum );
+				} else {
+					OpaqSurfExtFaceCondLossRep( SurfNum ) = -OpaqSurfOutsideFaceConduction( SurfNum );
+				}
+
+				// do average surface conduction updates
+
+				OpaqSurfAvgFaceConduction( SurfNum ) = ( OpaqSurfInsFaceConduction( SurfNum ) - OpaqSurfOutsideFaceConduction( SurfNum ) ) / 2.0;
+				OpaqSurfAvgFaceConductionFlux( SurfNum ) = ( OpaqSurfInsFaceConductionFlux( SurfNum ) - OpaqSurfOutsideFaceConductionFlux( SurfNum ) ) / 2.0;
+				OpaqSurfAvgFaceConductionEnergy( SurfNum ) = OpaqSurfAvgFaceConduction( SurfNum ) * SecInHour * TimeStepZone;
+				OpaqSurfAvgFaceCondGainRep( SurfNum ) = 0.0;
+				OpaqSurfAvgFaceCondLossRep( SurfNum ) = 0.0;
+				if ( OpaqSurfAvgFaceConduction( SurfNum ) >= 0.0 ) {
+					OpaqSurfAvgFaceCondGainRep( SurfNum ) = OpaqSurfAvgFaceConduction( SurfNum );
+				} else {
+					OpaqSurfAvgFaceCondLossRep( SurfNum ) = -OpaqSurfAvgFaceConduction( SurfNum );
+				}
+
+				// do surface storage rate updates
+				OpaqSurfStorageConductionFlux( SurfNum ) = -( OpaqSurfInsFaceConductionFlux( SurfNum ) + OpaqSurfOutsideFaceConductionFlux( SurfNum ) );
+				OpaqSurfStorageConduction( SurfNum ) = -( OpaqSurfInsFaceConduction( SurfNum ) + OpaqSurfOutsideFaceConduction( SurfNum ) );
+				OpaqSurfStorageConductionEnergy( SurfNum ) = OpaqSurfStorageConduction( SurfNum ) * SecInHour * TimeStepZone;
+				OpaqSurfStorageGainRep( SurfNum ) = 0.0;
+				OpaqSurfStorageCondLossRep( SurfNum ) = 0.0;
+				if ( OpaqSurfStorageConduction( SurfNum ) >= 0.0 ) {
+					OpaqSurfStorageGainRep( SurfNum ) = OpaqSurfStorageConduction( SurfNum );
+				} else {
+					OpaqSurfStorageCondLossRep( SurfNum ) = -OpaqSurfStorageConduction( SurfNum );
+				}
+
+			} // opaque heat transfer surfaces.
+
+		} // loop over surfaces
+
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ZoneOpaqSurfInsFaceCond( ZoneNum ) >= 0.0 ) {
+				ZoneOpaqSurfInsFaceCondGainRep( ZoneNum ) = ZoneOpaqSurfInsFaceCond( ZoneNum );
+				ZnOpqSurfInsFaceCondGnRepEnrg( ZoneNum ) = ZoneOpaqSurfInsFaceCondGainRep( ZoneNum ) * TimeStepZone * SecInHour;
+			} else {
+				ZoneOpaqSurfInsFaceCondLossRep( ZoneNum ) = -ZoneOpaqSurfInsFaceCond( ZoneNum );
+				ZnOpqSurfInsFaceCondLsRepEnrg( ZoneNum ) = ZoneOpaqSurfInsFaceCondLossRep( ZoneNum ) * TimeStepZone * SecInHour;
+			}
+
+			if ( ZoneOpaqSurfExtFaceCond( ZoneNum ) >= 0.0 ) {
+				ZoneOpaqSurfExtFaceCondGainRep( ZoneNum ) = ZoneOpaqSurfExtFaceCond( ZoneNum );
+				ZnOpqSurfExtFaceCondGnRepEnrg( ZoneNum ) = ZoneOpaqSurfExtFaceCondGainRep( ZoneNum ) * TimeStepZone * SecInHour;
+			} else {
+				ZoneOpaqSurfExtFaceCondLossRep( ZoneNum ) = -ZoneOpaqSurfExtFaceCond( ZoneNum );
+				ZnOpqSurfExtFaceCondLsRepEnrg( ZoneNum ) = ZoneOpaqSurfExtFaceCondLossRep( ZoneNum ) * TimeStepZone * SecInHour;
+			}
+		} // loop over zones
+
+	}
+
+	void
+	ReportInsideSurfIterations()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the average number of inside surface heat balance iterations of the
+		// environment just finished to the initialization output file, so runs with and
+		// without the inside surface temperature predictor can be compared.
+
+		// METHODOLOGY EMPLOYED:
+		// Only full (not zone resimulation) heat balances outside of warmup are counted.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool FirstWrite( true );
+		std::string PredictorName;
+
+		// Formats
+		static gio::Fmt Format_700( "('! <Inside Surface Heat Balance Iterations>, Environment Name, Inside Surface Temperature Predictor, ','Full Heat Balances, Average Iterations per Heat Balance, Predictor Fallbacks')" );
+		static gio::Fmt Format_701( "(' Inside Surface Heat Balance Iterations',5(',',A))" );
+
+		if ( InsideSurfSolveCount > 0 ) {
+			if ( FirstWrite ) {
+				gio::write( OutputFileInits, Format_700 );
+				FirstWrite = false;
+			}
+			if ( InsideSurfTempPredictor == InsideSurfTempPredictorLinear ) {
+				PredictorName = "Linear";
+			} else if ( InsideSurfTempPredictor == InsideSurfTempPredictorQuadratic ) {
+				PredictorName = "Quadratic";
+			} else {
+				PredictorName = "None";
+			}
+			gio::write( OutputFileInits, Format_701 ) << EnvironmentName << PredictorName << RoundSigDigits( InsideSurfSolveCount ) << RoundSigDigits( InsideSurfIterSum / double( InsideSurfSolveCount ), 3 ) << RoundSigDigits( InsideSurfFallbackSum );
+		}
+
+		InsideSurfIterSum = 0.0;
+		InsideSurfSolveCount = 0;
+		InsideSurfFallbackSum = 0;
+
+	}
+
+	void
+	InitHeatBalancePhaseCounters()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the hardware performance counters sampled around the surface heat balance phases:
+		// cycles, instructions, L1 data cache read misses, last level cache misses and branch misses.
+
+		// METHODOLOGY EMPLOYED:
+		// Only in builds with EP_HeatBalancePerfCounters defined (Linux).  The counters are one
+		// perf_event_open group for this thread, user space only, so they are read together by a
+		// single read() of the group leader.  If the kernel refuses any of them (no PMU access,
+		// perf_event_paranoid) a warning is issued and the phases are only timed.
+		// The group counts only the calling thread, so it is not opened when the heat balance loops
+		// run on more than one thread (InitHeatBalanceThreads, called first): the workers' share of
+		// the phases would be missing and the per surface timestep figures understated.
+
+		// REFERENCES:
+		// perf_event_open(2), Linux man-pages.
+
+#ifdef EP_HeatBalancePerfCounters
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::uint64_t const CounterType[ 5 ] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE };
+		static std::uint64_t const CounterConfig[ 5 ] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ), PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+		perf_event_attr Attr;
+		int Counter; // Counter DO loop counter
+
+		// FLOW:
+		if ( HeatBalancePhaseCountersActive ) return;
+		if ( HeatBalanceThreads > 1 ) {
+			ShowWarningError( "InitHeatBalancePhaseCounters: hardware performance counters only count the calling thread and the surface heat balance runs on " + RoundSigDigits( HeatBalanceThreads ) + " threads; surface heat balance phases will only be timed." );
+			return;
+		}
+		for ( Counter = 1; Counter <= NumPhaseCounters; ++Counter ) {
+			std::memset( &Attr, 0, sizeof( Attr ) );
+			Attr.size = sizeof( Attr );
+			Attr.type = CounterType[ Counter - 1 ];
+			Attr.config = CounterConfig[ Counter - 1 ];
+			Attr.disabled = ( Counter == 1 ) ? 1 : 0;
+			Attr.exclude_kernel = 1;
+			Attr.exclude_hv = 1;
+			Attr.read_format = PERF_FORMAT_GROUP;
+			PerfCounterFd( Counter ) = int( syscall( __NR_perf_event_open, &Attr, 0, -1, PerfCounterFd( 1 ), 0 ) );
+			if ( PerfCounterFd( Counter ) == -1 ) {
+				ShowWarningError( "InitHeatBalancePhaseCounters: hardware performance counters are not available (perf_event_open failed for " "counter " + RoundSigDigits( Counter ) + "); surface heat balance phases will only be timed." );
+				for ( int OpenCounter = 1; OpenCounter < Counter; ++OpenCounter ) {
+					close( PerfCounterFd( OpenCounter ) );
+					PerfCounterFd( OpenCounter ) = -1;
 				}
-			} else { // can we fill these for windows?
+				return;
+			}
+		}
+		ioctl( PerfCounterFd( 1 ), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+		ioctl( PerfCounterFd( 1 ), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+		HeatBalancePhaseCountersActive = true;
+#endif
+
+	}
+
+	bool
+	ReadHeatBalancePhaseCounters( FArray1D< Real64 > & Values ) // Current counts, one per counter
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads the free-running hardware counters opened by InitHeatBalancePhaseCounters.
+		// Returns false (and leaves Values alone) if they are not active.
+
+		// METHODOLOGY EMPLOYED:
+		// The group read returns the number of counters followed by their values.
+
+		// REFERENCES:
+		// na
+
+#ifdef EP_HeatBalancePerfCounters
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::uint64_t Buffer[ 6 ]; // Number of counters, then one value per counter
+
+		// FLOW:
+		if ( ! HeatBalancePhaseCountersActive ) return false;
+		if ( read( PerfCounterFd( 1 ), Buffer, sizeof( Buffer ) ) != ssize_t( sizeof( Buffer ) ) || Buffer[ 0 ] != std::uint64_t( NumPhaseCounters ) ) return false;
+		for ( int Counter = 1; Counter <= NumPhaseCounters; ++Counter ) {
+			Values( Counter ) = Real64( Buffer[ Counter ] );
+		}
+		return true;
+#else
+		return false;
+#endif
+
+	}
+
+	void
+	StartHeatBalancePhase( int const Phase ) // PhaseInitSurfaceHeatBalance, ...
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Marks the start of a timed surface heat balance phase.
 
+		// METHODOLOGY EMPLOYED:
+		// Different phases may nest (the green roof inside the outside heat balance); the
+		// same phase may not.
+
+		// REFERENCES:
+		// na
+
+		// FLOW:
+		++HeatBalancePhaseCalls( Phase );
+		if ( HeatBalancePhaseCountersActive && ReadHeatBalancePhaseCounters( PhaseCounterValues ) ) {
+			for ( int Counter = 1; Counter <= NumPhaseCounters; ++Counter ) {
+				HeatBalancePhaseCounterStart( Counter, Phase ) = PhaseCounterValues( Counter );
 			}
+		}
+		HeatBalancePhaseStartTime( Phase ) = std::chrono::steady_clock::now();
 
-			QdotRadIntGainsInRepPerArea( SurfNum ) = QRadThermInAbs( SurfNum );
-			QdotRadIntGainsInRep( SurfNum ) = QdotRadIntGainsInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
-			QRadIntGainsInReport( SurfNum ) = QdotRadIntGainsInRep( SurfNum ) * SecInHour * TimeStepZone;
+	}
 
-			QdotRadHVACInRepPerArea( SurfNum ) = QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum );
-			QdotRadHVACInRep( SurfNum ) = QdotRadHVACInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
-			QRadHVACInReport( SurfNum ) = QdotRadHVACInRep( SurfNum ) * SecInHour * TimeStepZone;
+	void
+	EndHeatBalancePhase( int const Phase ) // Phase passed to StartHeatBalancePhase
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the time since the matching StartHeatBalancePhase to the phase total.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// FLOW:
+		HeatBalancePhaseTime( Phase ) += std::chrono::duration< Real64 >( std::chrono::steady_clock::now() - HeatBalancePhaseStartTime( Phase ) ).count();
+		if ( HeatBalanceTraceActive ) HeatBalanceTraceSpan( HeatBalancePhaseNames( Phase ), HeatBalancePhaseStartTime( Phase ) );
+		if ( HeatBalancePhaseCountersActive && ReadHeatBalancePhaseCounters( PhaseCounterValues ) ) {
+			for ( int Counter = 1; Counter <= NumPhaseCounters; ++Counter ) {
+				HeatBalancePhaseCounters( Counter, Phase ) += PhaseCounterValues( Counter ) - HeatBalancePhaseCounterStart( Counter, Phase );
+			}
+		}
+
+	}
+
+	void
+	ReportHeatBalancePhases()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the time spent in each surface heat balance phase during the environment just
+		// finished to the initialization output file, so that the cost of the phases can be
+		// compared across buildings of different size.  With hardware counters active, also
+		// writes instructions per cycle and cache and branch misses per surface timestep, which
+		// separate memory-bound phases from compute-bound ones.
+
+		// METHODOLOGY EMPLOYED:
+		// Time per surface timestep divides the phase time by the number of surfaces and the
+		// number of ManageSurfaceHeatBalance calls (warmup included); the green roof is
+		// normalized by the same count, so it shows its share of the whole building.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool FirstWrite( true );
+		static bool FirstCounterWrite( true );
+		int Phase; // Phase DO loop counter
+		Real64 NsPerSurfStep; // Phase time per surface per ManageSurfaceHeatBalance call [ns]
+		Real64 SurfSteps; // Surface timesteps of the environment
+		Real64 IPC; // Instructions per cycle of the phase
+
+		// Formats
+		static gio::Fmt Format_730( "('! <Surface Heat Balance Phase Times>, Environment Name, Phase, Surfaces, Timesteps, Calls, ','Time {s}, Time per Surface Timestep {ns}')" );
+		static gio::Fmt Format_731( "(' Surface Heat Balance Phase Times',7(',',A))" );
+		static gio::Fmt Format_732( "('! <Surface Heat Balance Phase Counters>, Environment Name, Phase, Cycles, Instructions, ','Instructions per Cycle, L1 Data Misses per Surface Timestep, Last Level Cache Misses per Surface Timestep, ','Branch Misses per Surface Timestep')" );
+		static gio::Fmt Format_733( "(' Surface Heat Balance Phase Counters',8(',',A))" );
+
+		if ( HeatBalancePhaseSteps > 0 && TotSurfaces > 0 ) {
+			if ( FirstWrite ) {
+				gio::write( OutputFileInits, Format_730 );
+				FirstWrite = false;
+			}
+			for ( Phase = 1; Phase <= NumHeatBalancePhases; ++Phase ) {
+				if ( HeatBalancePhaseCalls( Phase ) == 0 ) continue;
+				NsPerSurfStep = HeatBalancePhaseTime( Phase ) * 1.0e9 / ( double( TotSurfaces ) * double( HeatBalancePhaseSteps ) );
+				gio::write( OutputFileInits, Format_731 ) << EnvironmentName << HeatBalancePhaseNames( Phase ) << RoundSigDigits( TotSurfaces ) << RoundSigDigits( HeatBalancePhaseSteps ) << RoundSigDigits( HeatBalancePhaseCalls( Phase ) ) << RoundSigDigits( HeatBalancePhaseTime( Phase ), 3 ) << RoundSigDigits( NsPerSurfStep, 1 );
+			}
+			if ( HeatBalancePhaseCountersActive ) {
+				if ( FirstCounterWrite ) {
+					gio::write( OutputFileInits, Format_732 );
+					FirstCounterWrite = false;
+				}
+				SurfSteps = double( TotSurfaces ) * double( HeatBalancePhaseSteps );
+				for ( Phase = 1; Phase <= NumHeatBalancePhases; ++Phase ) {
+					if ( HeatBalancePhaseCalls( Phase ) == 0 ) continue;
+					IPC = 0.0;
+					if ( HeatBalancePhaseCounters( CounterCycles, Phase ) > 0.0 ) IPC = HeatBalancePhaseCounters( CounterInstructions, Phase ) / HeatBalancePhaseCounters( CounterCycles, Phase );
+					gio::write( OutputFileInits, Format_733 ) << EnvironmentName << HeatBalancePhaseNames( Phase ) << RoundSigDigits( HeatBalancePhaseCounters( CounterCycles, Phase ), 0 ) << RoundSigDigits( HeatBalancePhaseCounters( CounterInstructions, Phase ), 0 ) << RoundSigDigits( IPC, 3 ) << RoundSigDigits( HeatBalancePhaseCounters( CounterL1DMisses, Phase ) / SurfSteps, 2 ) << RoundSigDigits( HeatBalancePhaseCounters( CounterLLCMisses, Phase ) / SurfSteps, 2 ) << RoundSigDigits( HeatBalancePhaseCounters( CounterBranchMisses, Phase ) / SurfSteps, 2 );
+				}
+			}
+		}
+
+		HeatBalancePhaseTime = 0.0;
+		HeatBalancePhaseCounters = 0.0;
+		HeatBalancePhaseCalls = 0;
+		HeatBalancePhaseSteps = 0;
+
+	}
+
+	void
+	ReportHeatBalanceScaling()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends one row for the environment just finished to the CSV file of
+		// Output:HeatBalanceScaling: building size, surface heat balance phase times, inside surface
+		// iterations and peak memory, so that runs of one building at several sizes can be compared.
+
+		// METHODOLOGY EMPLOYED:
+		// The file is appended to, so the rows of successive runs collect in one table; the header is
+		// written when the file is new.  Called before ReportInsideSurfIterations and
+		// ReportHeatBalancePhases reset their totals.  Peak memory is the largest resident set size of
+		// the process so far (getrusage); it is 0 where getrusage is not available.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Phase; // Phase DO loop counter
+		int NumEcoRoofSurf( 0 ); // Surfaces with a green roof
+		long PeakRSS( 0 ); // Peak resident set size [kB]
+		bool NewFile; // True if the file does not exist yet or is empty
+
+		// FLOW:
+		{ std::ifstream ExistingFile( HeatBalanceScalingFileName );
+		NewFile = ( ! ExistingFile || ExistingFile.peek() == std::ifstream::traits_type::eof() ); }
+		std::ofstream ScalingFile( HeatBalanceScalingFileName, std::ios::app );
+		if ( ! ScalingFile ) {
+			ShowWarningError( "ReportHeatBalanceScaling: Could not open file \"" + HeatBalanceScalingFileName + "\" for output (append); no row written." );
+			return;
+		}
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( SurfExtEcoRoof( SurfNum ) ) ++NumEcoRoofSurf;
+		}
+#ifndef _WIN32
+		struct rusage Usage;
+		if ( getrusage( RUSAGE_SELF, &Usage ) == 0 ) PeakRSS = Usage.ru_maxrss;
+#ifdef __APPLE__
+		PeakRSS /= 1024; // ru_maxrss is in bytes on macOS
+#endif
+#endif
+
+		if ( NewFile ) {
+			ScalingFile << "Case,Environment,Zones,Surfaces,Windows,Green Roof Surfaces,Timesteps";
+			for ( Phase = 1; Phase <= NumHeatBalancePhases; ++Phase ) {
+				ScalingFile << ',' << HeatBalancePhaseNames( Phase ) << " Time {s}";
+			}
+			ScalingFile << ",Full Inside Heat Balances,Average Inside Iterations,Peak Resident Memory {kB}\n";
+		}
+		ScalingFile << '"' << HeatBalanceScalingCase << "\",\"" << EnvironmentName << '"';
+		ScalingFile << ',' << RoundSigDigits( NumOfZones ) << ',' << RoundSigDigits( TotSurfaces ) << ',' << RoundSigDigits( NumWindowSurf ) << ',' << RoundSigDigits( NumEcoRoofSurf ) << ',' << RoundSigDigits( HeatBalancePhaseSteps );
+		for ( Phase = 1; Phase <= NumHeatBalancePhases; ++Phase ) {
+			ScalingFile << ',' << RoundSigDigits( HeatBalancePhaseTime( Phase ), 4 );
+		}
+		ScalingFile << ',' << RoundSigDigits( InsideSurfSolveCount ) << ',' << RoundSigDigits( ( InsideSurfSolveCount > 0 ) ? InsideSurfIterSum / double( InsideSurfSolveCount ) : 0.0, 3 ) << ',' << PeakRSS << '\n';
+
+	}
+
+	void
+	InitHeatBalanceThreads()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the number of threads of the parallel heat balance loops (HeatBalanceParallelFor and
+		// the reductions).
+
+		// METHODOLOGY EMPLOYED:
+		// Uses the thread count already resolved for the interior radiant exchange from
+		// ProgramControl and the OMP_NUM_THREADS/EP_OMP_NUM_THREADS environment variables;
+		// EP_HEATBALANCE_THREADS overrides it for these loops only.  Builds without OpenMP always
+		// run the loops serially.  Thread placement follows OMP_PROC_BIND/OMP_PLACES.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::NumberIntRadThreads;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		char const * ThreadsSetting( std::getenv( "EP_HEATBALANCE_THREADS" ) );
+
+		// FLOW:
+#ifdef _OPENMP
+		HeatBalanceThreads = max( NumberIntRadThreads, 1 );
+		if ( ThreadsSetting != nullptr && std::atoi( ThreadsSetting ) > 0 ) HeatBalanceThreads = std::atoi( ThreadsSetting );
+#else
+		HeatBalanceThreads = 1;
+		if ( ThreadsSetting != nullptr && std::atoi( ThreadsSetting ) > 1 ) {
+			ShowWarningError( "InitHeatBalanceThreads: EP_HEATBALANCE_THREADS is set but this program was built without OpenMP; heat balance loops run on one thread." );
+		}
+#endif
+
+	}
+
+	void
+	InitHeatBalanceTrace()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts the trace-event timeline if requested through the environment:
+		//   EP_HEATBALANCE_TRACE        name of the trace file (tracing is off if not set)
+		//   EP_HEATBALANCE_TRACE_EVERY  keep every Nth zone timestep (default 1, or 0 if a
+		//                               minimum duration is given)
+		//   EP_HEATBALANCE_TRACE_MIN_US also keep zone timesteps lasting at least this many
+		//                               microseconds
+		// Environments and days are always written; zone timesteps and the spans nested in them
+		// (heat balance phases, inside surface iterations, green roof solves) only when sampled.
+
+		// METHODOLOGY EMPLOYED:
+		// The file uses the JSON array form of the Chrome trace-event format with complete ("X")
+		// events, which may be left unterminated, so a run that stops early still leaves a
+		// readable trace.  It can be opened in chrome://tracing or the Perfetto UI.
+
+		// REFERENCES:
+		// Trace Event Format, Chromium project.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		char const * TraceFileName( std::getenv( "EP_HEATBALANCE_TRACE" ) );
+		char const * TraceEvery( std::getenv( "EP_HEATBALANCE_TRACE_EVERY" ) );
+		char const * TraceMinDuration( std::getenv( "EP_HEATBALANCE_TRACE_MIN_US" ) );
+
+		// FLOW:
+		if ( HeatBalanceTraceActive || TraceFileName == nullptr || TraceFileName[ 0 ] == '\0' ) return;
+
+		if ( TraceMinDuration != nullptr ) {
+			HeatBalanceTraceMinDuration = max( std::atof( TraceMinDuration ), 0.0 );
+			if ( HeatBalanceTraceMinDuration > 0.0 ) HeatBalanceTraceEveryN = 0;
+		}
+		if ( TraceEvery != nullptr ) HeatBalanceTraceEveryN = max( std::atoi( TraceEvery ), 0 );
+
+		HeatBalanceTraceFile.open( TraceFileName, std::ios::out | std::ios::trunc );
+		if ( ! HeatBalanceTraceFile ) {
+			ShowWarningError( "InitHeatBalanceTrace: could not open trace file \"" + std::string( TraceFileName ) + "\"; heat balance tracing is off." );
+			return;
+		}
+		HeatBalanceTraceFile << "[\n";
+		HeatBalanceTraceOrigin = std::chrono::steady_clock::now();
+		HeatBalanceTraceStepCount = 0;
+		HeatBalanceTraceStepEvents.clear();
+		HeatBalanceTraceActive = true;
+
+	}
+
+	std::chrono::steady_clock::time_point
+	HeatBalanceTraceMark()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Start time of a span for HeatBalanceTraceSpan; the clock is not read when tracing is off.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// FLOW:
+		if ( ! HeatBalanceTraceActive ) return std::chrono::steady_clock::time_point();
+		return std::chrono::steady_clock::now();
+
+	}
+
+	void
+	HeatBalanceTraceSpan(
+		std::string const & Name, // Span name shown by the trace viewer
+		std::chrono::steady_clock::time_point const StartTime, // HeatBalanceTraceMark at the start of the span
+		bool const Sampled // False for spans written regardless of the timestep sampling
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Records a span from StartTime to now.
+
+		// METHODOLOGY EMPLOYED:
+		// Sampled spans are held with the zone timestep in progress until EndHeatBalanceTraceStep
+		// decides whether to keep it; the others go straight to the file.  Times are in
+		// microseconds from the start of the trace.  Names may come from input (environment
+		// names), so quotes, backslashes and control characters are escaped for JSON.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 StartUs; // Span start [us]
+		Real64 DurationUs; // Span length [us]
+		std::string Event; // Trace event
+		std::string EscapedName; // Name as a JSON string body
+		static char const HexDigits[] = "0123456789abcdef";
+
+		// FLOW:
+		if ( ! HeatBalanceTraceActive ) return;
+
+		EscapedName.reserve( Name.size() );
+		for ( char const c : Name ) {
+			if ( c == '"' || c == '\\' ) {
+				EscapedName += '\\';
+				EscapedName += c;
+			} else if ( static_cast< unsigned char >( c ) < 0x20 ) {
+				EscapedName += "\\u00";
+				EscapedName += HexDigits[ ( c >> 4 ) & 0xF ];
+				EscapedName += HexDigits[ c & 0xF ];
+			} else {
+				EscapedName += c;
+			}
+		}
+
+		StartUs = std::chrono::duration< Real64, std::micro >( StartTime - HeatBalanceTraceOrigin ).count();
+		DurationUs = std::chrono::duration< Real64, std::micro >( std::chrono::steady_clock::now() - StartTime ).count();
+		Event = "{\"name\":\"" + EscapedName + "\",\"cat\":\"HeatBalance\",\"ph\":\"X\",\"ts\":" + RoundSigDigits( StartUs, 3 ) + ",\"dur\":" + RoundSigDigits( DurationUs, 3 ) + ",\"pid\":1,\"tid\":1},\n";
+		if ( Sampled ) {
+			HeatBalanceTraceStepEvents += Event;
+		} else {
+			HeatBalanceTraceFile << Event;
+		}
+
+	}
+
+	void
+	EndHeatBalanceTraceStep( std::chrono::steady_clock::time_point const StartTime ) // Start of the zone timestep
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Closes the span of a zone timestep and writes it, with everything nested in it, if the
+		// timestep is sampled: every HeatBalanceTraceEveryN-th timestep, and any timestep lasting
+		// at least HeatBalanceTraceMinDuration.  Unsampled timesteps are dropped.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 DurationUs; // Length of the zone timestep [us]
+		bool KeepStep; // True if the timestep is written
 
-			if ( Surface( SurfNum ).Class == SurfaceClass_Floor || Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_IntMass || Surface( SurfNum ).Class == SurfaceClass_Roof || Surface( SurfNum ).Class == SurfaceClass_Door ) {
+		// FLOW:
+		if ( ! HeatBalanceTraceActive ) return;
+
+		++HeatBalanceTraceStepCount;
+		DurationUs = std::chrono::duration< Real64, std::micro >( std::chrono::steady_clock::now() - StartTime ).count();
+		KeepStep = ( HeatBalanceTraceEveryN > 0 && mod( HeatBalanceTraceStepCount, HeatBalanceTraceEveryN ) == 0 ) || ( HeatBalanceTraceMinDuration > 0.0 && DurationUs >= HeatBalanceTraceMinDuration );
+		if ( KeepStep ) {
+			HeatBalanceTraceSpan( "Zone Timestep", StartTime );
+			HeatBalanceTraceFile << HeatBalanceTraceStepEvents;
+		}
+		HeatBalanceTraceStepEvents.clear();
 
-				// inside face conduction updates
-				OpaqSurfInsFaceConductionEnergy( SurfNum ) = OpaqSurfInsFaceConduction( SurfNum ) * SecInHour * TimeStepZone;
-				ZoneOpaqSurfInsFaceCond( Surface( SurfNum ).Zone ) += OpaqSurfInsFaceConduction( SurfNum );
-				OpaqSurfInsFaceCondGainRep( SurfNum ) = 0.0;
-				OpaqSurfInsFaceCondLossRep( SurfNum ) = 0.0;
-				if ( OpaqSurfInsFaceConduction( SurfNum ) >= 0.0 ) {
-					OpaqSurfInsFaceCondGainRep( SurfNum ) = OpaqSurfInsFaceConduction( SurfNum );
-				} else {
-					OpaqSurfInsFaceCondLossRep( SurfNum ) = -OpaqSurfInsFaceConduction( SurfNum );
-				}
+	}
 
-				// outside face conduction updates
-				OpaqSurfOutsideFaceConductionEnergy( SurfNum ) = OpaqSurfOutsideFaceConduction( SurfNum ) * SecInHour * TimeStepZone;
-				ZoneOpaqSurfExtFaceCond( Surface( SurfNum ).Zone ) += OpaqSurfOutsideFaceConduction( SurfNum );
-				OpaqSurfExtFaceCondGainRep( SurfNum ) = 0.0;
-				OpaqSurfExtFaceCondLossRep( SurfNum ) = 0.0;
-				if ( OpaqSurfOutsideFaceConduction( SurfNum ) >= 0.0 ) {
-					OpaqSurfExtFaceCondGainRep( SurfNum ) = OpaqSurfOutsideFaceConduction( SurfNum );
-				} else {
-					OpaqSurfExtFaceCondLossRep( SurfNum ) = -OpaqSurfOutsideFaceConduction( SurfNum );
-				}
+	void
+	ReportCheckpointDifferences(
+		HeatBalanceCheckpoint const & Reference, // State of the reference (serial) simulation
+		std::string const & Label // Identifies the chunk boundary in the report
+	)
+	{
 
-				// do average surface conduction updates
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
 
-				OpaqSurfAvgFaceConduction( SurfNum ) = ( OpaqSurfInsFaceConduction( SurfNum ) - OpaqSurfOutsideFaceConduction( SurfNum ) ) / 2.0;
-				OpaqSurfAvgFaceConductionFlux( SurfNum ) = ( OpaqSurfInsFaceConductionFlux( SurfNum ) - OpaqSurfOutsideFaceConductionFlux( SurfNum ) ) / 2.0;
-				OpaqSurfAvgFaceConductionEnergy( SurfNum ) = OpaqSurfAvgFaceConduction( SurfNum ) * SecInHour * TimeStepZone;
-				OpaqSurfAvgFaceCondGainRep( SurfNum ) = 0.0;
-				OpaqSurfAvgFaceCondLossRep( SurfNum ) = 0.0;
-				if ( OpaqSurfAvgFaceConduction( SurfNum ) >= 0.0 ) {
-					OpaqSurfAvgFaceCondGainRep( SurfNum ) = OpaqSurfAvgFaceConduction( SurfNum );
-				} else {
-					OpaqSurfAvgFaceCondLossRep( SurfNum ) = -OpaqSurfAvgFaceConduction( SurfNum );
-				}
+		// PURPOSE OF THIS SUBROUTINE:
+		// Compares the current surface heat balance state with a reference state at a chunk
+		// boundary of a time-decomposed run and writes the largest differences to the
+		// initialization output file.
 
-				// do surface storage rate updates
-				OpaqSurfStorageConductionFlux( SurfNum ) = -( OpaqSurfInsFaceConductionFlux( SurfNum ) + OpaqSurfOutsideFaceConductionFlux( SurfNum ) );
-				OpaqSurfStorageConduction( SurfNum ) = -( OpaqSurfInsFaceConduction( SurfNum ) + OpaqSurfOutsideFaceConduction( SurfNum ) );
-				OpaqSurfStorageConductionEnergy( SurfNum ) = OpaqSurfStorageConduction( SurfNum ) * SecInHour * TimeStepZone;
-				OpaqSurfStorageGainRep( SurfNum ) = 0.0;
-				OpaqSurfStorageCondLossRep( SurfNum ) = 0.0;
-				if ( OpaqSurfStorageConduction( SurfNum ) >= 0.0 ) {
-					OpaqSurfStorageGainRep( SurfNum ) = OpaqSurfStorageConduction( SurfNum );
-				} else {
-					OpaqSurfStorageCondLossRep( SurfNum ) = -OpaqSurfStorageConduction( SurfNum );
-				}
+		// METHODOLOGY EMPLOYED:
+		// Maximum absolute differences over heat transfer surfaces of the outside and inside face
+		// temperatures (TH of the current term), with the surfaces where they occur, and the
+		// differences in green roof soil moisture (the larger of the two green roof models).
 
-			} // opaque heat transfer surfaces.
+		// REFERENCES:
+		// na
 
-		} // loop over surfaces
+		// Using/Aliasing
+		using General::RoundSigDigits;
+		using EcoRoofManager::Moisture;
+		using EcoRoofManager::MeanRootMoisture;
+		using EcoRoofManager::PlantCoverMoisture;
+		using EcoRoofManager::PlantCoverMeanRootMoisture;
 
-		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-			if ( ZoneOpaqSurfInsFaceCond( ZoneNum ) >= 0.0 ) {
-				ZoneOpaqSurfInsFaceCondGainRep( ZoneNum ) = ZoneOpaqSurfInsFaceCond( ZoneNum );
-				ZnOpqSurfInsFaceCondGnRepEnrg( ZoneNum ) = ZoneOpaqSurfInsFaceCondGainRep( ZoneNum ) * TimeStepZone * SecInHour;
-			} else {
-				ZoneOpaqSurfInsFaceCondLossRep( ZoneNum ) = -ZoneOpaqSurfInsFaceCond( ZoneNum );
-				ZnOpqSurfInsFaceCondLsRepEnrg( ZoneNum ) = ZoneOpaqSurfInsFaceCondLossRep( ZoneNum ) * TimeStepZone * SecInHour;
-			}
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool FirstWrite( true );
+		int SurfNum; // Surface number DO loop counter
+		Real64 MaxDiffOut( 0.0 ); // Largest outside face temperature difference [deltaC]
+		Real64 MaxDiffIn( 0.0 ); // Largest inside face temperature difference [deltaC]
+		int MaxDiffOutSurf( 0 ); // Surface with the largest outside face difference
+		int MaxDiffInSurf( 0 ); // Surface with the largest inside face difference
+
+		// Formats
+		static gio::Fmt Format_710( "('! <Heat Balance Checkpoint Comparison>, Boundary, Max Outside Face Temperature Difference {deltaC}, ','Surface, Max Inside Face Temperature Difference {deltaC}, Surface, ','Soil Moisture Difference {}, Root Zone Moisture Difference {}')" );
+		static gio::Fmt Format_711( "(' Heat Balance Checkpoint Comparison',7(',',A))" );
+
+		if ( ! equal_dimensions( Reference.TH, TH ) ) {
+			ShowSevereError( "ReportCheckpointDifferences: Reference state for " + Label + " does not match this simulation; comparison skipped." );
+			return;
+		}
 
-			if ( ZoneOpaqSurfExtFaceCond( ZoneNum ) >= 0.0 ) {
-				ZoneOpaqSurfExtFaceCondGainRep( ZoneNum ) = ZoneOpaqSurfExtFaceCond( ZoneNum );
-				ZnOpqSurfExtFaceCondGnRepEnrg( ZoneNum ) = ZoneOpaqSurfExtFaceCondGainRep( ZoneNum ) * TimeStepZone * SecInHour;
-			} else {
-				ZoneOpaqSurfExtFaceCondLossRep( ZoneNum ) = -ZoneOpaqSurfExtFaceCond( ZoneNum );
-				ZnOpqSurfExtFaceCondLsRepEnrg( ZoneNum ) = ZoneOpaqSurfExtFaceCondLossRep( ZoneNum ) * TimeStepZone * SecInHour;
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
+			Real64 const DiffOut( std::abs( TH( SurfNum, 1, 1 ) - Reference.TH( SurfNum, 1, 1 ) ) );
+			Real64 const DiffIn( std::abs( TH( SurfNum, 1, 2 ) - Reference.TH( SurfNum, 1, 2 ) ) );
+			if ( DiffOut > MaxDiffOut || MaxDiffOutSurf == 0 ) {
+				MaxDiffOut = DiffOut;
+				MaxDiffOutSurf = SurfNum;
 			}
-		} // loop over zones
+			if ( DiffIn > MaxDiffIn || MaxDiffInSurf == 0 ) {
+				MaxDiffIn = DiffIn;
+				MaxDiffInSurf = SurfNum;
+			}
+		}
+		if ( MaxDiffOutSurf == 0 ) return;
+
+		if ( FirstWrite ) {
+			gio::write( OutputFileInits, Format_710 );
+			FirstWrite = false;
+		}
+		gio::write( OutputFileInits, Format_711 ) << Label << RoundSigDigits( MaxDiffOut, 4 ) << Surface( MaxDiffOutSurf ).Name << RoundSigDigits( MaxDiffIn, 4 ) << Surface( MaxDiffInSurf ).Name << RoundSigDigits( max( std::abs( Moisture - Reference.SoilMoisture ), std::abs( PlantCoverMoisture - Reference.PlantCoverSoilMoisture ) ), 5 ) << RoundSigDigits( max( std::abs( MeanRootMoisture - Reference.RootMoisture ), std::abs( PlantCoverMeanRootMoisture - Reference.PlantCoverRootMoisture ) ), 5 );
 
 	}
 
@@ -4340,6 +6624,19 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 	using EcoRoofManager::CalcEcoRoof;
 	//'GreenRoof_with_PlantCoverage' added. (Neda Yaghoobian 2014)
 	using EcoRoofManager::GreenRoof_with_PlantCoverage;
+	using HeatBalanceSurfaceManager::ExtVentCavSolved;
+	using HeatBalanceSurfaceManager::SurfZone;
+	using HeatBalanceSurfaceManager::SurfClass;
+	using HeatBalanceSurfaceManager::SurfHeatTransSurf;
+	using HeatBalanceSurfaceManager::SurfHeatTransferAlgorithm;
+	using HeatBalanceSurfaceManager::SurfExtBoundCond;
+	using HeatBalanceSurfaceManager::SurfConstruction;
+	using HeatBalanceSurfaceManager::SurfArea;
+	using HeatBalanceSurfaceManager::SurfExtEcoRoof;
+	using HeatBalanceSurfaceManager::SurfOSCMPtr;
+	using HeatBalanceSurfaceManager::NumOutsideBatch;
+	using HeatBalanceSurfaceManager::OutsideBatchSurf;
+	using HeatBalanceSurfaceManager::OutsideBatchTempExt;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4383,6 +6680,8 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 	int OPtr;
 	Real64 RhoVaporSat; // Local temporary saturated vapor density for checking
 	bool GreenRoofModel_PC; //
+	int CavNum; // Exterior vented cavity in front of the surface
+	bool DeferredToBatch; // True if the outside face of this surface is left to CalcOutsideSurfTempBatch
 
 
 	// FUNCTION DEFINITIONS:
@@ -4393,10 +6692,10 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 		// Need to transfer any source/sink for a surface to the local array.  Note that
 		// the local array is flux (W/m2) while the QRadSysSource is heat transfer (W).
 		// This must be done at this location so that this is always updated correctly.
-		if ( Surface( SurfNum ).Area > 0.0 ) QsrcHist( SurfNum, 1 ) = QRadSysSource( SurfNum ) / Surface( SurfNum ).Area; // Make sure we don't divide by zero...
+		if ( SurfArea( SurfNum ) > 0.0 ) QsrcHist( SurfNum, 1 ) = QRadSysSource( SurfNum ) / SurfArea( SurfNum ); // Make sure we don't divide by zero...
 
 		// next we add source (actually a sink) from any integrated PV
-		if ( Surface( SurfNum ).Area > 0.0 ) QsrcHist( SurfNum, 1 ) += QPVSysSource( SurfNum ) / Surface( SurfNum ).Area; // Make sure we don't divide by zero...
+		if ( SurfArea( SurfNum ) > 0.0 ) QsrcHist( SurfNum, 1 ) += QPVSysSource( SurfNum ) / SurfArea( SurfNum ); // Make sure we don't divide by zero...
 	}
 
 	if ( present( ZoneToResimulate ) ) {
@@ -4405,9 +6704,21 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 		CalcInteriorRadExchange( TH( _, 1, 2 ), 0, NetLWRadToSurf, _, Outside );
 	}
 
+	// Each exterior vented cavity is solved once per pass, from the first surface behind it
+	if ( TotExtVentCav > 0 ) ExtVentCavSolved = false;
+
+	// Outside face conduction coefficients used by all exterior CTF surface models below
+	if ( present( ZoneToResimulate ) ) {
+		CalcCTFOutFaceCoupling( ZoneToResimulate );
+	} else {
+		CalcCTFOutFaceCoupling();
+	}
+
+	NumOutsideBatch = 0;
+
 	for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
 
-		ZoneNum = Surface( SurfNum ).Zone;
+		ZoneNum = SurfZone( SurfNum );
 
 		if ( present( ZoneToResimulate ) ) {
 			if ( ( ZoneNum != ZoneToResimulate ) && ( AdjacentZoneToSurface( SurfNum ) != ZoneToResimulate ) ) {
@@ -4415,15 +6726,16 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			}
 		}
 
-		if ( ! Surface( SurfNum ).HeatTransSurf || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
+		if ( ! SurfHeatTransSurf( SurfNum ) || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
 
-		if ( Surface( SurfNum ).Class == SurfaceClass_Window ) continue;
+		if ( SurfClass( SurfNum ) == SurfaceClass_Window ) continue;
 		// Interior windows in partitions use "normal" heat balance calculations
 		// For rest, Outside surface temp of windows not needed in Window5 calculation approach.
 		// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
 
 		// Initializations for this surface
-		ConstrNum = Surface( SurfNum ).Construction;
+		ConstrNum = SurfConstruction( SurfNum );
+		DeferredToBatch = false;
 		HMovInsul = 0.0;
 		HSky = 0.0;
 		HGround = 0.0;
@@ -4435,7 +6747,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 		// Calculate the current outside surface temperature TH(SurfNum,1,1) for the
 		// various different boundary conditions
-		{ auto const SELECT_CASE_var( Surface( SurfNum ).ExtBoundCond );
+		{ auto const SELECT_CASE_var( SurfExtBoundCond( SurfNum ) );
 
 		if ( SELECT_CASE_var == Ground ) { // Surface in contact with ground
 
@@ -4445,7 +6757,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
 
 			// start HAMT
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the HAMT moisture balance
 				TempOutsideAirFD( SurfNum ) = GroundTemp;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTemp, 1.0, HBSurfManGroundHAMT );
@@ -4459,7 +6771,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			}
 			// end HAMT
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) {
 				// Set variables used in the FD moisture balance
 				TempOutsideAirFD( SurfNum ) = GroundTemp;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTemp, 1.0 );
@@ -4478,7 +6790,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			// Set the only radiant system heat balance coefficient that is non-zero for this case
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the HAMT moisture balance
 				TempOutsideAirFD( SurfNum ) = GroundTempFC;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTempFC, 1.0, HBSurfManGroundHAMT );
@@ -4491,7 +6803,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 				HAirFD( SurfNum ) = HAir;
 			}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) {
 				// Set variables used in the FD moisture balance
 				TempOutsideAirFD( SurfNum ) = GroundTempFC;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTempFC, 1.0 );
@@ -4534,7 +6846,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			// Set the only radiant system heat balance coefficient that is non-zero for this case
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the FD moisture balance and HAMT
 				TempOutsideAirFD( SurfNum ) = TH( SurfNum, 1, 1 );
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4574,7 +6886,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			// Set the only radiant system heat balance coefficient that is non-zero for this case
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the FD moisture balance and HAMT
 				TempOutsideAirFD( SurfNum ) = TempExt;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4586,7 +6898,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			}
 
 			// Call the outside surface temp calculation and pass the necessary terms
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CTF || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
 
 			// This ends the calculations for this surface and goes on to the next SurfNum
 
@@ -4595,7 +6907,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 			// First, set up the outside convection coefficient and the exterior temperature
 			// boundary condition for the surface
-			OPtr = Surface( SurfNum ).OSCMPtr;
+			OPtr = SurfOSCMPtr( SurfNum );
 			// EMS overrides
 			if ( OSCM( OPtr ).EMSOverrideOnTConv ) OSCM( OPtr ).TConv = OSCM( OPtr ).EMSOverrideTConvValue;
 			if ( OSCM( OPtr ).EMSOverrideOnHConv ) OSCM( OPtr ).HConv = OSCM( OPtr ).EMSOverrideHConvValue;
@@ -4608,7 +6920,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			// Set the only radiant system heat balance coefficient that is non-zero for this case
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( SurfNum, 1, 1 );
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the FD moisture balance and HAMT
 				TempOutsideAirFD( SurfNum ) = TempExt;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4619,18 +6931,18 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 				HAirFD( SurfNum ) = 0.0; //CR 8046, null out and use only sky term for surface to baffle IR
 			}
 
-			// Call the outside surface temp calculation and pass the necessary terms
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
-
-				if ( Surface( SurfNum ).ExtCavityPresent ) {
-					CalcExteriorVentedCavity( SurfNum );
+			// Solve the exterior vented cavity on the first surface behind it; the others use that solution
+			if ( Surface( SurfNum ).ExtCavityPresent ) {
+				CavNum = Surface( SurfNum ).ExtCavNum;
+				if ( ! ExtVentCavSolved( CavNum ) && ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CTF || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) ) {
+					CalcExteriorVentedCavity( CavNum );
+					ExtVentCavSolved( CavNum ) = true;
 				}
+			}
 
+			// Call the outside surface temp calculation and pass the necessary terms
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CTF || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) {
 				CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
-			} else if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				if ( Surface( SurfNum ).ExtCavityPresent ) {
-					CalcExteriorVentedCavity( SurfNum );
-				}
 			}
 
 			// This ends the calculations for this surface and goes on to the next SurfNum
@@ -4639,7 +6951,8 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			//checking the EcoRoof presented in the external environment
 			// recompute each load by calling ecoroof
 
-			if ( Surface( SurfNum ).ExtEcoRoof ) {
+			if ( SurfExtEcoRoof( SurfNum ) ) {
+				StartHeatBalancePhase( PhaseGreenRoof );
 			//Adding the following two lines for Green Roof with Plant Coverage
 				if ( GreenRoofModel_PC) {
 					GreenRoof_with_PlantCoverage( SurfNum, ZoneNum, ConstrNum, TempExt );
@@ -4647,6 +6960,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 				} else {
 					CalcEcoRoof( SurfNum, ZoneNum, ConstrNum, TempExt );
 				}
+				EndHeatBalancePhase( PhaseGreenRoof );
 				continue;
 			}
 
@@ -4674,7 +6988,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 					TempExt = Surface( SurfNum ).OutWetBulbTemp;
 
 					// start HAMT
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 						// Set variables used in the HAMT moisture balance
 						TempOutsideAirFD( SurfNum ) = TempExt;
 						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManRainHAMT );
@@ -4686,7 +7000,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 					}
 					// end HAMT
 
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) {
 						// Set variables used in the FD moisture balance
 						TempOutsideAirFD( SurfNum ) = TempExt;
 						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( TempOutsideAirFD( SurfNum ), 1.0 );
@@ -4701,7 +7015,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 					TempExt = Surface( SurfNum ).OutDryBulbTemp;
 
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 						// Set variables used in the FD moisture balance and HAMT
 						TempOutsideAirFD( SurfNum ) = TempExt;
 						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4724,7 +7038,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 				TempExt = Surface( SurfNum ).OutDryBulbTemp;
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 					// Set variables used in the FD moisture balance and HAMT
 					TempOutsideAirFD( SurfNum ) = TempExt;
 					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4737,17 +7051,28 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 			}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CTF || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) {
+				// The common case (no movable insulation, TDD dome or radiant source) is evaluated for all
+				// such surfaces at once after this loop; nothing later in the loop needs this TH(SurfNum,1,1).
+				if ( HMovInsul <= 0.0 && SurfClass( SurfNum ) != SurfaceClass_TDD_Dome && ! Construct( ConstrNum ).SourceSinkPresent ) {
+					OutsideBatchTempExt( SurfNum ) = TempExt;
+					++NumOutsideBatch;
+					OutsideBatchSurf( NumOutsideBatch ) = SurfNum;
+					DeferredToBatch = true;
+				} else {
+					CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
+				}
+			}
 
 		} else { // for interior or other zone surfaces
 
-			if ( Surface( SurfNum ).ExtBoundCond == SurfNum ) { // Regular partition/internal mass
+			if ( SurfExtBoundCond( SurfNum ) == SurfNum ) { // Regular partition/internal mass
 
 				TH( SurfNum, 1, 1 ) = TempSurfIn( SurfNum );
 
 				// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 					// Set variables used in the FD moisture balance HAMT
 					TempOutsideAirFD( SurfNum ) = TempSurfIn( SurfNum );
 					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( SurfNum );
@@ -4760,15 +7085,15 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 			} else { // Interzone partition
 
-				TH( SurfNum, 1, 1 ) = TH( Surface( SurfNum ).ExtBoundCond, 1, 2 );
+				TH( SurfNum, 1, 1 ) = TH( SurfExtBoundCond( SurfNum ), 1, 2 );
 
 				// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 					// Set variables used in the FD moisture balance and HAMT
-					TempOutsideAirFD( SurfNum ) = TH( Surface( SurfNum ).ExtBoundCond, 1, 2 );
-					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( Surface( SurfNum ).ExtBoundCond );
-					HConvExtFD( SurfNum ) = HConvIn( Surface( SurfNum ).ExtBoundCond );
+					TempOutsideAirFD( SurfNum ) = TH( SurfExtBoundCond( SurfNum ), 1, 2 );
+					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( SurfExtBoundCond( SurfNum ) );
+					HConvExtFD( SurfNum ) = HConvIn( SurfExtBoundCond( SurfNum ) );
 					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameIZPart ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
 					HSkyFD( SurfNum ) = 0.0;
 					HGrndFD( SurfNum ) = 0.0;
@@ -4780,19 +7105,15 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			// This ends the calculations for this surface and goes on to the next SurfNum
 		}}
 
-		//fill in reporting values for outside face
-		QdotConvOutRep( SurfNum ) = -Surface( SurfNum ).Area * HcExtSurf( SurfNum ) * ( TH( SurfNum, 1, 1 ) - Surface( SurfNum ).OutDryBulbTemp );
-
-		if ( Surface( SurfNum ).OSCMPtr > 0 ) { //Optr is set above in this case, use OSCM boundary data
-			QdotConvOutRepPerArea( SurfNum ) = -OSCM( OPtr ).HConv * ( TH( SurfNum, 1, 1 ) - OSCM( OPtr ).TConv );
-		} else {
-			QdotConvOutRepPerArea( SurfNum ) = -HcExtSurf( SurfNum ) * ( TH( SurfNum, 1, 1 ) - Surface( SurfNum ).OutDryBulbTemp );
-		}
+		if ( DeferredToBatch ) continue; // reported by CalcOutsideSurfTempBatch
 
-		QConvOutReport( SurfNum ) = QdotConvOutRep( SurfNum ) * SecInHour * TimeStepZone;
+		//fill in reporting values for outside face
+		ReportOutsideSurfConvection( SurfNum );
 
 	} // ...end of DO loop over all surface (actually heat transfer surfaces)
 
+	CalcOutsideSurfTempBatch();
+
 }
 
 void
@@ -4872,6 +7193,19 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	using DataZoneEquipment::ZoneEquipConfig;
 	using DataLoopNode::Node;
 	using HeatBalanceSurfaceManager::CalculateZoneMRT;
+	using HeatBalanceSurfaceManager::TempSurfInHist;
+	using HeatBalanceSurfaceManager::NumTempSurfInHist;
+	using HeatBalanceSurfaceManager::TempSurfInPredictPending;
+	using HeatBalanceSurfaceManager::TempSurfInPredicted;
+	using HeatBalanceSurfaceManager::InsideSurfPredictorFallbacks;
+	using HeatBalanceSurfaceManager::InsideSurfIterSum;
+	using HeatBalanceSurfaceManager::InsideSurfSolveCount;
+	using HeatBalanceSurfaceManager::InsideSurfFallbackSum;
+	using HeatBalanceSurfaceManager::HConvInEvalDelTemp;
+	using HeatBalanceSurfaceManager::TempInsOld;
+	using HeatBalanceSurfaceManager::RefAirTemp;
+	using HeatBalanceSurfaceManager::HConvInEvalCount;
+	using HeatBalanceSurfaceManager::HConvInSkipCount;
 	using namespace Psychrometrics;
 	using OutputReportTabular::loadConvectedNormal;
 	using OutputReportTabular::loadConvectedWithPulse;
@@ -4879,6 +7213,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	using DataSizing::CurOverallSimDay;
 	using namespace DataTimings;
 	using WindowEquivalentLayer::EQLWindowOutsideEffectiveEmiss;
+	using HeatBalanceSurfaceManager::SurfZone;
+	using HeatBalanceSurfaceManager::SurfClass;
+	using HeatBalanceSurfaceManager::SurfHeatTransSurf;
+	using HeatBalanceSurfaceManager::SurfHeatTransferAlgorithm;
+	using HeatBalanceSurfaceManager::SurfExtBoundCond;
+	using HeatBalanceSurfaceManager::SurfConstruction;
+	using HeatBalanceSurfaceManager::SurfArea;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4887,6 +7228,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	Real64 const Sigma( 5.6697e-08 ); // Stefan-Boltzmann constant
 	Real64 const IterDampConst( 5.0 ); // Damping constant for inside surface temperature iterations
 	int const ItersReevalConvCoeff( 30 ); // Number of iterations between inside convection coefficient reevaluations
+	Real64 const ReevalConvCoeffDelTemp( 0.01 ); // Change in surface to air temperature difference that triggers a reevaluation
 	Real64 const MaxAllowedDelTemp( 0.002 ); // Convergence criteria for inside surface temperatures
 	int const MaxIterations( 500 ); // Maximum number of iterations allowed for inside surface temps
 	int const IterationsForCondFDRelaxChange( 5 ); // number of iterations for inside temps that triggers a change
@@ -4918,7 +7260,6 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	int RoughSurf; // Outside surface roughness
 	Real64 EmisOut; // Glass outside surface emissivity
 
-	static FArray1D< Real64 > TempInsOld; // Holds previous iteration's value for convergence check
 	Real64 RhoVaporSat; // Local temporary saturated vapor density for checking
 	Real64 TempSurfOutTmp; // Local Temporary Surface temperature for the outside surface face
 	Real64 TempSurfInSat; // Local temperary surface dew point temperature
@@ -4928,6 +7269,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	//  CHARACTER(len=25):: ErrMsg
 	//  CHARACTER(len=5) :: TimeStmp
 	static int ErrCount( 0 );
+	static std::vector< int > ConvChangedZones; // Zones whose inside convection coefficients are re-evaluated this iteration
 	int PipeNum; // TDD pipe object number
 	int SurfNum2; // TDD:DIFFUSER object number
 	Real64 Ueff; // 1 / effective R value between TDD:DOME and TDD:DIFFUSER
@@ -4940,7 +7282,6 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	Real64 MassFlowRate;
 	Real64 NodeTemp;
 	Real64 CpAir;
-	static FArray1D< Real64 > RefAirTemp; // reference air temperatures
 	static bool MyEnvrnFlag( true );
 	//  LOGICAL, SAVE     :: DoThisLoop
 	static int InsideSurfErrCount( 0 );
@@ -4949,11 +7290,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	int OtherSideZoneNum; // Zone Number index for other side of an interzone partition HAMT
 	static int WarmupSurfTemp;
 	static int TimeStepInDay( 0 ); // time step number
+	bool PredictorActive; // True if this heat balance starts from extrapolated inside face temperatures
+	bool PredictorRestarted; // True if a surface was restarted from its last converged temperature
 
 	// FLOW:
 	if ( firstTime ) {
-		TempInsOld.allocate( TotSurfaces );
-		RefAirTemp.allocate( TotSurfaces );
+		TempSurfInHist.dimension( TotSurfaces, 3, 0.0 );
+		TempSurfInPredicted.dimension( TotSurfaces, false );
 		if ( any_eq( HeatTransferAlgosUsed, UseEMPD ) ) {
 			MinIterations = MinEMPDIterations;
 		} else {
@@ -4961,6 +7304,11 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		}
 		if ( DisplayAdvancedReportVariables ) {
 			SetupOutputVariable( "Surface Inside Face Heat Balance Calculation Iteration Count []", InsideSurfIterations, "ZONE", "Sum", "Simulation" );
+			if ( InsideSurfTempPredictor != InsideSurfTempPredictorNone ) {
+				SetupOutputVariable( "Surface Inside Face Heat Balance Predictor Fallback Count []", InsideSurfPredictorFallbacks, "ZONE", "Sum", "Simulation" );
+			}
+			SetupOutputVariable( "Surface Inside Face Convection Coefficient Reevaluation Count []", HConvInEvalCount, "ZONE", "Sum", "Simulation" );
+			SetupOutputVariable( "Surface Inside Face Convection Coefficient Skipped Reevaluation Count []", HConvInSkipCount, "ZONE", "Sum", "Simulation" );
 		}
 	}
 	if ( BeginEnvrnFlag && MyEnvrnFlag ) {
@@ -4968,6 +7316,8 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		RefAirTemp = 23.0;
 		TempEffBulkAir = 23.0;
 		WarmupSurfTemp = 0;
+		NumTempSurfInHist = 0; // Do not extrapolate across environments
+		TempSurfInPredictPending = false;
 		MyEnvrnFlag = false;
 	}
 	if ( ! BeginEnvrnFlag ) {
@@ -4982,7 +7332,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 	// determine reference air temperatures
 	for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-		ZoneNum = Surface( SurfNum ).Zone;
+		ZoneNum = SurfZone( SurfNum );
 
 		if ( PartialResimulate ) {
 			if ( ( ZoneNum != ZoneToResimulate ) && ( AdjacentZoneToSurface( SurfNum ) != ZoneToResimulate ) ) { // Surface not relevant
@@ -4995,8 +7345,8 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		}
 
 		// These conditions are not used in every SurfNum loop here so we don't use them to skip surfaces
-		if ( ! Surface( SurfNum ).HeatTransSurf || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
-		if ( Surface( SurfNum ).Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
+		if ( ! SurfHeatTransSurf( SurfNum ) || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
+		if ( SurfClass( SurfNum ) == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
 
 		if ( PartialResimulate ) {
 			WinHeatGain( SurfNum ) = 0.0;
@@ -5082,7 +7432,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) {
 		auto const & zone( Zone( iZone ) );
 		for ( int iSurf = zone.SurfaceFirst, eSurf = zone.SurfaceLast; iSurf <= eSurf; ++iSurf ) { //Tuned Replaced any_eq and array slicing and member array usage
-			auto const alg( Surface( iSurf ).HeatTransferAlgorithm );
+			auto const alg( SurfHeatTransferAlgorithm( iSurf ) );
 			if ( ( alg == HeatTransferModel_CondFD ) || ( alg == HeatTransferModel_HAMT ) ) {
 				any_surface_ConFD_or_HAMT( iZone ) = true;
 				break;
@@ -5091,9 +7441,39 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	}
 
 	bool const useCondFDHTalg( any_eq( HeatTransferAlgosUsed, UseCondFD ) );
+
+	// On the first full heat balance of a timestep, extrapolate the starting inside face temperature of
+	// CTF and EMPD surfaces from the converged values of the last two (three) timesteps.  The prediction
+	// is the starting point of the damping term and of the first interior radiant exchange.
+	PredictorActive = false;
+	PredictorRestarted = false;
+	if ( TempSurfInPredictPending && ! PartialResimulate ) {
+		TempSurfInPredictPending = false;
+		InsideSurfPredictorFallbacks = 0;
+		TempSurfInPredicted = false;
+		if ( NumTempSurfInHist >= 2 ) {
+			bool const Quadratic( InsideSurfTempPredictor == InsideSurfTempPredictorQuadratic && NumTempSurfInHist >= 3 );
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( ! SurfHeatTransSurf( SurfNum ) || SurfZone( SurfNum ) == 0 ) continue;
+				if ( SurfClass( SurfNum ) == SurfaceClass_Window || SurfClass( SurfNum ) == SurfaceClass_TDD_Dome ) continue;
+				if ( SurfHeatTransferAlgorithm( SurfNum ) != HeatTransferModel_CTF && SurfHeatTransferAlgorithm( SurfNum ) != HeatTransferModel_EMPD ) continue;
+				Real64 TempPredicted;
+				if ( Quadratic ) {
+					TempPredicted = 3.0 * TempSurfInHist( SurfNum, 1 ) - 3.0 * TempSurfInHist( SurfNum, 2 ) + TempSurfInHist( SurfNum, 3 );
+				} else {
+					TempPredicted = 2.0 * TempSurfInHist( SurfNum, 1 ) - TempSurfInHist( SurfNum, 2 );
+				}
+				TempSurfIn( SurfNum ) = max( MinSurfaceTempLimit, min( MaxSurfaceTempLimit, TempPredicted ) );
+				TempSurfInPredicted( SurfNum ) = true;
+				PredictorActive = true;
+			}
+		}
+	}
+
 	Converged = false;
 	while ( ! Converged ) { // Start of main inside heat balance DO loop...
 
+		auto const IterationStartTime( HeatBalanceTraceMark() );
 		TempInsOld = TempSurfIn; // Keep track of last iteration's temperature values
 
 		CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneToResimulate, Inside ); // Update the radiation balance
@@ -5104,23 +7484,60 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		// heat balance is in error (potentially) once HConvIn is re-evaluated.
 		// The choice of 30 is not significant--just want to do this a couple of
 		// times before the iteration limit is hit.
+		// Only zones in which some surface to air temperature difference has moved by more than
+		// ReevalConvCoeffDelTemp since the last evaluation are recalculated.  The changed zones are
+		// collected first so that InitInteriorConvectionCoeffs, which can only be restricted to a single
+		// zone, makes one pass over the surfaces: restricted when one zone changed, full otherwise.
 		if ( ( InsideSurfIterations > 0 ) && ( mod( InsideSurfIterations, ItersReevalConvCoeff ) == 0 ) ) {
-			InitInteriorConvectionCoeffs( TempSurfIn, ZoneToResimulate );
+			ConvChangedZones.clear();
+			for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) {
+				if ( PartialResimulate && iZone != ZoneToResimulate ) continue;
+				auto const & zone( Zone( iZone ) );
+				for ( int iSurf = zone.SurfaceFirst, eSurf = zone.SurfaceLast; iSurf <= eSurf; ++iSurf ) {
+					if ( ! SurfHeatTransSurf( iSurf ) ) continue;
+					if ( std::abs( TempSurfIn( iSurf ) - MAT( iZone ) - HConvInEvalDelTemp( iSurf ) ) > ReevalConvCoeffDelTemp ) {
+						ConvChangedZones.push_back( iZone );
+						break;
+					}
+				}
+			}
+			bool const AllZonesEvaluated( ConvChangedZones.size() > 1u );
+			if ( ConvChangedZones.size() == 1u ) {
+				InitInteriorConvectionCoeffs( TempSurfIn, ConvChangedZones[ 0 ] );
+			} else if ( AllZonesEvaluated ) {
+				InitInteriorConvectionCoeffs( TempSurfIn );
+			}
+			std::vector< int >::size_type iChanged( 0u );
+			for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) {
+				if ( PartialResimulate && iZone != ZoneToResimulate ) continue;
+				auto const & zone( Zone( iZone ) );
+				int const NumZoneSurfs( max( zone.SurfaceLast - zone.SurfaceFirst + 1, 0 ) );
+				bool const ZoneChanged( iChanged < ConvChangedZones.size() && ConvChangedZones[ iChanged ] == iZone );
+				if ( ZoneChanged ) ++iChanged;
+				if ( ZoneChanged || AllZonesEvaluated ) {
+					for ( int iSurf = zone.SurfaceFirst, eSurf = zone.SurfaceLast; iSurf <= eSurf; ++iSurf ) {
+						HConvInEvalDelTemp( iSurf ) = TempSurfIn( iSurf ) - MAT( iZone );
+					}
+					HConvInEvalCount += NumZoneSurfs;
+				} else {
+					HConvInSkipCount += NumZoneSurfs;
+				}
+			}
 		}
 
 		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
 			SurfNum = SurfToResimulate[ iSurfToResimulate ];
 			auto & surface( Surface( SurfNum ) );
-			ZoneNum = surface.Zone;
+			ZoneNum = SurfZone( SurfNum );
 
-			if ( ! surface.HeatTransSurf || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
-			if ( surface.Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
+			if ( ! SurfHeatTransSurf( SurfNum ) || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
+			if ( SurfClass( SurfNum ) == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
 
 			Real64 & TH11( TH( SurfNum, 1, 1 )  );
 			Real64 & TH12( TH( SurfNum, 1, 2 )  );
 			Real64 & TH22( TH( SurfNum, 2, 2 )  );
 
-			ConstrNum = surface.Construction;
+			ConstrNum = SurfConstruction( SurfNum );
 
 			//Calculate the inside surface moisture quantities
 			//calculate the inside surface moisture transfer conditions
@@ -5145,19 +7562,19 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			//   (d) the HAMT calc (solutionalgo = UseHAMT).
 
 			auto & zone( Zone( ZoneNum ) );
-			if ( surface.ExtBoundCond == SurfNum && surface.Class != SurfaceClass_Window ) {
+			if ( SurfExtBoundCond( SurfNum ) == SurfNum && SurfClass( SurfNum ) != SurfaceClass_Window ) {
 				//CR6869 -- let Window HB take care of it      IF (Surface(SurfNum)%ExtBoundCond == SurfNum) THEN
 				// Surface is a partition
-				if ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
+				if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CTF || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) {
 						CalcMoistureBalanceEMPD( SurfNum, TempSurfInTmp( SurfNum ), TH22, MAT( ZoneNum ), TempSurfInSat );
 					}
 					Real64 const TempTerm( CTFConstInPart( SurfNum ) + QRadThermInAbs( SurfNum ) + QRadSWInAbs( SurfNum ) + HConvIn( SurfNum ) * RefAirTemp( SurfNum ) + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) + NetLWRadToSurf( SurfNum ) );
 					Real64 const TempDiv( 1.0 / ( Construct( ConstrNum ).CTFInside( 0 ) - Construct( ConstrNum ).CTFCross( 0 ) + HConvIn( SurfNum ) + IterDampConst ) );
 					TempSurfInTmp( SurfNum ) = ( TempTerm + Construct( ConstrNum ).CTFSourceIn( 0 ) * QsrcHist( SurfNum, 1 ) + IterDampConst * TempInsOld( SurfNum ) ) * TempDiv; // Constant portion of conduction eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Net radiant exchange with other zone surfaces | Heat source/sink term for radiant systems | (if there is one present) | Radiant flux from a high temperature radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Iterative damping term (for stability) | Conduction term (both partition sides same temp) | Conduction term (both partition sides same temp) | Convection and damping term
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) {
 						TempSurfInTmp( SurfNum ) -= MoistEMPDFlux( SurfNum ) * TempDiv; // Conduction term (both partition sides same temp) | Conduction term (both partition sides same temp) | Convection and damping term
 						if ( TempSurfInSat > TempSurfInTmp( SurfNum ) ) {
 							TempSurfInTmp( SurfNum ) = TempSurfInSat; // Surface temp cannot be below dew point
@@ -5176,11 +7593,11 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 					}
 
-				} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				} else if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 
 					TH11 = TempSurfOutTmp;
 
@@ -5190,22 +7607,22 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 			} else { // Standard surface or interzone surface
 
-				if ( surface.Class != SurfaceClass_Window ) { // Opaque surface
+				if ( SurfClass( SurfNum ) != SurfaceClass_Window ) { // Opaque surface
 
 					HMovInsul = 0.0;
 					if ( surface.MaterialMovInsulInt > 0 ) EvalInsideMovableInsulation( SurfNum, HMovInsul, AbsInt );
 
 					if ( HMovInsul <= 0.0 ) { // No movable insulation present, normal heat balance equation
 
-						if ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
+						if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CTF || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+							if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) {
 								CalcMoistureBalanceEMPD( SurfNum, TempSurfInTmp( SurfNum ), TH22, MAT( ZoneNum ), TempSurfInSat );
 							}
 							Real64 const TempTerm( CTFConstInPart( SurfNum ) + QRadThermInAbs( SurfNum ) + QRadSWInAbs( SurfNum ) + HConvIn( SurfNum ) * RefAirTemp( SurfNum ) + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) + NetLWRadToSurf( SurfNum ) );
 							Real64 const TempDiv( 1.0 / ( Construct( ConstrNum ).CTFInside( 0 ) + HConvIn( SurfNum ) + IterDampConst ) );
 							TempSurfInTmp( SurfNum ) = ( TempTerm + Construct( ConstrNum ).CTFSourceIn( 0 ) * QsrcHist( SurfNum, 1 ) + IterDampConst * TempInsOld( SurfNum ) + Construct( ConstrNum ).CTFCross( 0 ) * TH11 ) * TempDiv; // Constant part of conduction eq (history terms) | LW radiation from internal sources | SW radiation from internal sources | Convection from surface to zone air | Net radiant exchange with other zone surfaces | Heat source/sink term for radiant systems | (if there is one present) | Radiant flux from high temp radiant heater | Radiant flux from a hot water baseboard heater | Radiant flux from a steam baseboard heater | Radiant flux from an electric baseboard heater | Iterative damping term (for stability) | Current conduction from | the outside surface | Coefficient for conduction (current time) | Convection and damping term
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+							if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) {
 								TempSurfInTmp( SurfNum ) -= MoistEMPDFlux( SurfNum ) * TempDiv; // Coefficient for conduction (current time) | Convection and damping term
 								if ( TempSurfInSat > TempSurfInTmp( SurfNum ) ) {
 									TempSurfInTmp( SurfNum ) = TempSurfInSat; // Surface temp cannot be below dew point
@@ -5222,13 +7639,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 								RadSysTiHBToutCoef( SurfNum ) = Construct( ConstrNum ).CTFCross( 0 ) * RadSysDiv; // Outside temp=inside temp for a partition | Cond term (both partition sides same temp) | Convection and damping term
 								RadSysTiHBQsrcCoef( SurfNum ) = Construct( ConstrNum ).CTFSourceIn( 0 ) * RadSysDiv; // QTF term for the source | Cond term (both partition sides same temp) | Convection and damping term
 
-								if ( surface.ExtBoundCond > 0 ) { // This is an interzone partition and we need to set outside params
+								if ( SurfExtBoundCond( SurfNum ) > 0 ) { // This is an interzone partition and we need to set outside params
 									// The inside coefficients of one side are equal to the outside coefficients of the other side.  But,
 									// the inside coefficients are set up once the heat balance equation for that side has been calculated.
 									// For both sides to actually have been set, we have to wait until we get to the second side in the surface
 									// derived type.  At that point, both inside coefficient sets have been evaluated.
-									if ( surface.ExtBoundCond < SurfNum ) { // Both of the inside coefficients have now been set
-										OtherSideSurfNum = surface.ExtBoundCond;
+									if ( SurfExtBoundCond( SurfNum ) < SurfNum ) { // Both of the inside coefficients have now been set
+										OtherSideSurfNum = SurfExtBoundCond( SurfNum );
 										RadSysToHBConstCoef( OtherSideSurfNum ) = RadSysTiHBConstCoef( SurfNum );
 										RadSysToHBTinCoef( OtherSideSurfNum ) = RadSysTiHBToutCoef( SurfNum );
 										RadSysToHBQsrcCoef( OtherSideSurfNum ) = RadSysTiHBQsrcCoef( SurfNum );
@@ -5240,20 +7657,20 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 							}
 
-						} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+						} else if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-								if ( surface.ExtBoundCond > 0 ) {
+							if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
+								if ( SurfExtBoundCond( SurfNum ) > 0 ) {
 									// HAMT get the correct other side zone zone air temperature --
-									OtherSideSurfNum = surface.ExtBoundCond;
-									ZoneNum = surface.Zone;
-									OtherSideZoneNum = Surface( OtherSideSurfNum ).Zone;
+									OtherSideSurfNum = SurfExtBoundCond( SurfNum );
+									ZoneNum = SurfZone( SurfNum );
+									OtherSideZoneNum = SurfZone( OtherSideSurfNum );
 									TempOutsideAirFD( SurfNum ) = MAT( OtherSideZoneNum );
 								}
 								ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 							}
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+							if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 
 							TH11 = TempSurfOutTmp;
 
@@ -5292,13 +7709,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 						Real64 const Sigma_Temp_4( Sigma * pow_4( TempSurfIn( SurfNum ) ) );
 
 						// Calculate window heat gain for TDD:DIFFUSER since this calculation is usually done in WindowManager
-						WinHeatGain( SurfNum ) = WinTransSolar( SurfNum ) + HConvIn( SurfNum ) * surface.Area * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) ) + Construct( surface.Construction ).InsideAbsorpThermal * surface.Area * ( Sigma_Temp_4 - ( SurfaceWindow( SurfNum ).IRfromParentZone + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) ) ) - QS( surface.Zone ) * surface.Area * Construct( surface.Construction ).TransDiff; // Transmitted solar | Convection | IR exchange | IR
+						WinHeatGain( SurfNum ) = WinTransSolar( SurfNum ) + HConvIn( SurfNum ) * SurfArea( SurfNum ) * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) ) + Construct( SurfConstruction( SurfNum ) ).InsideAbsorpThermal * SurfArea( SurfNum ) * ( Sigma_Temp_4 - ( SurfaceWindow( SurfNum ).IRfromParentZone + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) ) ) - QS( SurfZone( SurfNum ) ) * SurfArea( SurfNum ) * Construct( SurfConstruction( SurfNum ) ).TransDiff; // Transmitted solar | Convection | IR exchange | IR
 						// Zone diffuse interior shortwave reflected back into the TDD
 
 						//fill out report vars for components of Window Heat Gain
-						WinGainConvGlazToZoneRep( SurfNum ) = HConvIn( SurfNum ) * surface.Area * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) );
-						WinGainIRGlazToZoneRep( SurfNum ) = Construct( surface.Construction ).InsideAbsorpThermal * surface.Area * ( Sigma_Temp_4 - ( SurfaceWindow( SurfNum ).IRfromParentZone + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) ) );
-						WinLossSWZoneToOutWinRep( SurfNum ) = QS( surface.Zone ) * surface.Area * Construct( surface.Construction ).TransDiff;
+						WinGainConvGlazToZoneRep( SurfNum ) = HConvIn( SurfNum ) * SurfArea( SurfNum ) * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) );
+						WinGainIRGlazToZoneRep( SurfNum ) = Construct( SurfConstruction( SurfNum ) ).InsideAbsorpThermal * SurfArea( SurfNum ) * ( Sigma_Temp_4 - ( SurfaceWindow( SurfNum ).IRfromParentZone + QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) ) );
+						WinLossSWZoneToOutWinRep( SurfNum ) = QS( SurfZone( SurfNum ) ) * SurfArea( SurfNum ) * Construct( SurfConstruction( SurfNum ) ).TransDiff;
 						if ( WinHeatGain( SurfNum ) >= 0.0 ) {
 							WinHeatGainRep( SurfNum ) = WinHeatGain( SurfNum );
 							WinHeatGainRepEnergy( SurfNum ) = WinHeatGainRep( SurfNum ) * TimeStepZone * SecInHour;
@@ -5317,7 +7734,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 							// InitExteriorConvectionCoeff from CalcWindowHeatBalance, which avoids circular reference
 							// (HeatBalanceSurfaceManager USEing and WindowManager and
 							// WindowManager USEing HeatBalanceSurfaceManager)
-							if ( surface.ExtBoundCond == ExternalEnvironment ) {
+							if ( SurfExtBoundCond( SurfNum ) == ExternalEnvironment ) {
 								RoughSurf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Roughness;
 								EmisOut = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpThermalFront;
 								auto const shading_flag( SurfaceWindow( SurfNum ).ShadingFlag );
@@ -5358,7 +7775,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 									HcExtSurf( SurfNum ) = SetExtConvectionCoeff( SurfNum );
 								} else {
 									// Exterior Convection Coefficient for the Interior or Interzone Window is the Interior Convection Coeff of same
-									HcExtSurf( SurfNum ) = HConvIn( surface.ExtBoundCond );
+									HcExtSurf( SurfNum ) = HConvIn( SurfExtBoundCond( SurfNum ) );
 								}
 
 							}
@@ -5386,7 +7803,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 			// sign convention is positive means energy going into inside face from the air.
 			auto const HConvInTemp_fac( -HConvIn( SurfNum ) * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) ) );
-			QdotConvInRep( SurfNum ) = surface.Area * HConvInTemp_fac;
+			QdotConvInRep( SurfNum ) = SurfArea( SurfNum ) * HConvInTemp_fac;
 			QdotConvInRepPerArea( SurfNum ) = HConvInTemp_fac;
 			QConvInReport( SurfNum ) = QdotConvInRep( SurfNum ) * SecInHour * TimeStepZone;
 
@@ -5557,7 +7974,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			// Interzones must have an exterior boundary condition greater than zero
 			// (meaning that the other side is a surface) and the surface number must
 			// not be the surface itself (which is just a simple partition)
-			int const surfExtBoundCond( Surface( SurfNum ).ExtBoundCond );
+			int const surfExtBoundCond( SurfExtBoundCond( SurfNum ) );
 			if ( ( surfExtBoundCond > 0 ) && ( surfExtBoundCond != SurfNum ) ) {
 				// Set the outside surface temperature to the inside surface temperature
 				// of the interzone pair and reassign the reporting variable.  By going
@@ -5568,18 +7985,33 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		}
 
 		++InsideSurfIterations;
+		if ( HeatBalanceTraceActive ) HeatBalanceTraceSpan( "Inside Surface Iteration", IterationStartTime );
+
+		// Predictor fallback: a surface whose first iterate lies farther from its extrapolated start than
+		// from its last converged temperature is restarted from the last converged temperature
+		if ( PredictorActive && InsideSurfIterations == 1 ) {
+			for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) {
+				SurfNum = SurfToResimulate[ iSurfToResimulate ];
+				if ( ! TempSurfInPredicted( SurfNum ) ) continue;
+				if ( std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) ) > std::abs( TempSurfIn( SurfNum ) - TempSurfInHist( SurfNum, 1 ) ) ) {
+					TempSurfIn( SurfNum ) = TempSurfInHist( SurfNum, 1 );
+					++InsideSurfPredictorFallbacks;
+					PredictorRestarted = true;
+				}
+			}
+		}
 
 		// Convergence check
 		MaxDelTemp = 0.0;
 		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Loop through all relevant surfaces to check for convergence...
 			SurfNum = SurfToResimulate[ iSurfToResimulate ];
 
-			if ( ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+			if ( ! SurfHeatTransSurf( SurfNum ) ) continue; // Skip non-heat transfer surfaces
 
-			ConstrNum = Surface( SurfNum ).Construction;
+			ConstrNum = SurfConstruction( SurfNum );
 			if ( Construct( ConstrNum ).TransDiff <= 0.0 ) { // Opaque surface
 				MaxDelTemp = max( std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) ), MaxDelTemp );
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+				if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) {
 					// also check all internal nodes as well as surface faces
 					MaxDelTemp = max( MaxDelTemp, SurfaceFD( SurfNum ).MaxNodeDelTemp );
 				}
@@ -5615,6 +8047,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 #endif
 
 		if ( InsideSurfIterations < MinIterations ) Converged = false;
+		if ( PredictorRestarted && InsideSurfIterations == 1 ) Converged = false;
 
 		if ( InsideSurfIterations > MaxIterations ) {
 			if ( ! WarmupFlag ) {
@@ -5636,24 +8069,30 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 	} // ...end of main inside heat balance DO loop (ends when Converged)
 
+	if ( ! PartialResimulate && ! WarmupFlag ) {
+		InsideSurfIterSum += InsideSurfIterations;
+		++InsideSurfSolveCount;
+		if ( PredictorActive ) InsideSurfFallbackSum += InsideSurfPredictorFallbacks;
+	}
+
 	// Update SumHmXXXX
 	if ( useCondFDHTalg || any_eq( HeatTransferAlgosUsed, UseEMPD ) || any_eq( HeatTransferAlgosUsed, UseHAMT ) ) {
 		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) {
 			SurfNum = SurfToResimulate[ iSurfToResimulate ];
 			auto const & surface( Surface( SurfNum ) );
-			if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
-			if ( surface.Class == SurfaceClass_Window ) continue;
+			if ( ! SurfHeatTransSurf( SurfNum ) ) continue; // Skip non-heat transfer surfaces
+			if ( SurfClass( SurfNum ) == SurfaceClass_Window ) continue;
 
-			ZoneNum = surface.Zone;
+			ZoneNum = SurfZone( SurfNum );
 
-			if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				UpdateHeatBalHAMT( SurfNum );
 
-				Real64 const FD_Area_fac( HMassConvInFD( SurfNum ) * surface.Area );
+				Real64 const FD_Area_fac( HMassConvInFD( SurfNum ) * SurfArea( SurfNum ) );
 
 				SumHmAW( ZoneNum ) += FD_Area_fac * ( RhoVaporSurfIn( SurfNum ) - RhoVaporAirIn( SurfNum ) );
 
-				Real64 const MAT_zone( MAT( surface.Zone ) );
+				Real64 const MAT_zone( MAT( SurfZone( SurfNum ) ) );
 				RhoAirZone = PsyRhoAirFnPbTdbW( OutBaroPress, MAT_zone, PsyWFnTdbRhPb( MAT_zone, PsyRhFnTdbRhov( MAT_zone, RhoVaporAirIn( SurfNum ), rhoAirZone ), OutBaroPress ) );
 
 				Real64 const surfInTemp( TempSurfInTmp( SurfNum ) );
@@ -5662,7 +8101,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 				SumHmARa( ZoneNum ) += FD_Area_fac * RhoAirZone;
 
 				SumHmARaW( ZoneNum ) += FD_Area_fac * RhoAirZone * Wsurf;
-			} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+			} else if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) {
 				// need to calculate the amount of moisture that is entering or
 				// leaving the zone  Qm [kg/sec] = hmi * Area * (Del Rhov)
 				// {Hmi [m/sec];     Area [m2];    Rhov [kg moist/m3]  }
@@ -5675,7 +8114,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 				RhoVaporSurfIn( SurfNum ) = MoistEMPDNew( SurfNum );
 				//SUMC(ZoneNum) = SUMC(ZoneNum)-MoistEMPDFlux(SurfNum)*Surface(SurfNum)%Area
 
-				Real64 const FD_Area_fac( HMassConvInFD( SurfNum ) * surface.Area );
+				Real64 const FD_Area_fac( HMassConvInFD( SurfNum ) * SurfArea( SurfNum ) );
 				SumHmAW( ZoneNum ) += FD_Area_fac * ( RhoVaporSurfIn( SurfNum ) - RhoVaporAirIn( SurfNum ) );
 				Real64 const surfInTemp( TempSurfInTmp( SurfNum ) );
 				SumHmARa( ZoneNum ) += FD_Area_fac * PsyRhoAirFnPbTdbW( OutBaroPress, surfInTemp, PsyWFnTdbRhPb( surfInTemp, PsyRhFnTdbRhovLBnd0C( surfInTemp, RhoVaporAirIn( SurfNum ) ), OutBaroPress ) );
@@ -5702,8 +8141,8 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
 		SurfNum = SurfToResimulate[ iSurfToResimulate ];
 		if ( ! Surface( SurfNum ).ExtSolar ) continue; // WindowManager's definition of ZoneWinHeatGain/Loss
-		if ( Surface( SurfNum ).Class != SurfaceClass_Window ) continue;
-		ZoneNum = Surface( SurfNum ).Zone;
+		if ( SurfClass( SurfNum ) != SurfaceClass_Window ) continue;
+		ZoneNum = SurfZone( SurfNum );
 		if ( ZoneNum == 0 ) continue;
 		ZoneWinHeatGain( ZoneNum ) += WinHeatGain( SurfNum );
 	}
@@ -5784,6 +8223,12 @@ CalcOutsideSurfTemp(
 	using namespace DataDaylightingDevices;
 	using DaylightingDevices::FindTDDPipe;
 	using namespace Psychrometrics;
+	using HeatBalanceSurfaceManager::SurfZone;
+	using HeatBalanceSurfaceManager::SurfClass;
+	using HeatBalanceSurfaceManager::SurfArea;
+	using HeatBalanceSurfaceManager::SurfOSCMPtr;
+	using HeatBalanceSurfaceManager::CTFOutFaceCondConst;
+	using HeatBalanceSurfaceManager::CTFOutFaceCondCoef;
 
 	// Locals
 	// SUBROUTINE PARAMETER DEFINITIONS:
@@ -5800,7 +8245,6 @@ CalcOutsideSurfTemp(
 	Real64 F1; // Intermediate calculation variable
 	Real64 F2; // Intermediate calculation variable
 	bool MovInsulPresent; // .TRUE. if movable insulation is currently present for surface
-	bool QuickConductionSurf; // .TRUE. if the cross CTF term is relatively large
 	int PipeNum; // TDD pipe object number
 	int SurfNum2; // TDD:DIFFUSER object number
 	int ZoneNum2; // TDD:DIFFUSER zone number
@@ -5817,17 +8261,10 @@ CalcOutsideSurfTemp(
 		MovInsulPresent = false;
 	}
 
-	// Determine whether this surface is a "slow conductive" or "quick conductive"
-	// surface.  Designates are inherited from BLAST.  Basically, a "quick" surface
-	// requires the inside heat balance to be accounted for in the heat balance
-	// while a "slow" surface can used the last time step's value for inside
-	// surface temperature.
-	if ( Construct( ConstrNum ).CTFCross( 0 ) > 0.01 ) {
-		QuickConductionSurf = true;
-		F1 = Construct( ConstrNum ).CTFCross( 0 ) / ( Construct( ConstrNum ).CTFInside( 0 ) + HConvIn( SurfNum ) );
-	} else {
-		QuickConductionSurf = false;
-	}
+	// Whether this surface is a "slow conductive" or "quick conductive" surface (designates
+	// inherited from BLAST) is accounted for in CTFOutFaceCondConst and CTFOutFaceCondCoef:
+	// a "quick" surface includes the inside heat balance while a "slow" surface uses the last
+	// time step's value for inside surface temperature.  See CalcCTFOutFaceCoupling.
 
 	// Now, calculate the outside surface temperature using the proper heat balance equation.
 	// Each case has been separated out into its own IF-THEN block for clarity.  Additional
@@ -5837,12 +8274,12 @@ CalcOutsideSurfTemp(
 
 	// Outside heat balance case: Tubular daylighting device
 	Real64 & TH11( TH( SurfNum, 1, 1 )  );
-	if ( Surface( SurfNum ).Class == SurfaceClass_TDD_Dome ) {
+	if ( SurfClass( SurfNum ) == SurfaceClass_TDD_Dome ) {
 
 		// Lookup up the TDD:DIFFUSER object
 		PipeNum = FindTDDPipe( SurfNum );
 		SurfNum2 = TDDPipe( PipeNum ).Diffuser;
-		ZoneNum2 = Surface( SurfNum2 ).Zone;
+		ZoneNum2 = SurfZone( SurfNum2 );
 		Ueff = 1.0 / TDDPipe( PipeNum ).Reff;
 		F1 = Ueff / ( Ueff + HConvIn( SurfNum2 ) );
 
@@ -5855,52 +8292,31 @@ CalcOutsideSurfTemp(
 		// *QsrcHist(SurfNum,1)                &
 		TH11 = ( QRadSWwinAbs( SurfNum, 1 ) / 2.0 + ( HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) ) * TempExt + HSkyExtSurf( SurfNum ) * SkyTemp + HGrdExtSurf( SurfNum ) * OutDryBulbTemp + F1 * ( QRadSWwinAbs( SurfNum2, 1 ) / 2.0 + QRadThermInAbs( SurfNum2 ) + HConvIn( SurfNum2 ) * MAT( ZoneNum2 ) + NetLWRadToSurf( SurfNum2 ) ) ) / ( Ueff + HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) + HSkyExtSurf( SurfNum ) + HGrdExtSurf( SurfNum ) - F1 * Ueff ); // Instead of QRadSWOutAbs(SurfNum) | ODB used to approx ground surface temp | Use TDD:DIFFUSER surface | Use TDD:DIFFUSER surface | Use TDD:DIFFUSER surface and zone | Use TDD:DIFFUSER surface
 
-		// Outside heat balance case: No movable insulation, slow conduction
-	} else if ( ( ! MovInsulPresent ) && ( ! QuickConductionSurf ) ) {
-		if ( Surface( SurfNum ).OSCMPtr == 0 ) {
-			TH11 = ( -CTFConstOutPart( SurfNum ) + QRadSWOutAbs( SurfNum ) + ( HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) ) * TempExt + HSkyExtSurf( SurfNum ) * SkyTemp + HGrdExtSurf( SurfNum ) * OutDryBulbTemp + Construct( ConstrNum ).CTFCross( 0 ) * TempSurfIn( SurfNum ) + Construct( ConstrNum ).CTFSourceOut( 0 ) * QsrcHist( SurfNum, 1 ) ) / ( Construct( ConstrNum ).CTFOutside( 0 ) + HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) + HSkyExtSurf( SurfNum ) + HGrdExtSurf( SurfNum ) ); // ODB used to approx ground surface temp
+		// Outside heat balance case: No movable insulation
+	} else if ( ! MovInsulPresent ) {
+		if ( SurfOSCMPtr( SurfNum ) == 0 ) {
+			TH11 = ( CTFOutFaceCondConst( SurfNum ) + QRadSWOutAbs( SurfNum ) + ( HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) ) * TempExt + HSkyExtSurf( SurfNum ) * SkyTemp + HGrdExtSurf( SurfNum ) * OutDryBulbTemp + Construct( ConstrNum ).CTFSourceOut( 0 ) * QsrcHist( SurfNum, 1 ) ) / ( CTFOutFaceCondCoef( SurfNum ) + HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) + HSkyExtSurf( SurfNum ) + HGrdExtSurf( SurfNum ) ); // ODB used to approx ground surface temp
 			// Outside Heat Balance case: Other Side Conditions Model
 		} else { //( Surface(SurfNum)%OSCMPtr > 0 ) THEN
 			// local copies of variables for clarity in radiation terms
-			RadTemp = OSCM( Surface( SurfNum ).OSCMPtr ).TRad;
-			HRad = OSCM( Surface( SurfNum ).OSCMPtr ).HRad;
+			RadTemp = OSCM( SurfOSCMPtr( SurfNum ) ).TRad;
+			HRad = OSCM( SurfOSCMPtr( SurfNum ) ).HRad;
 
-			// patterned after "No movable insulation, slow conduction," but with new radiation terms and no sun,
-			TH11 = ( -CTFConstOutPart( SurfNum ) + HcExtSurf( SurfNum ) * TempExt + HRad * RadTemp + Construct( ConstrNum ).CTFCross( 0 ) * TempSurfIn( SurfNum ) + Construct( ConstrNum ).CTFSourceOut( 0 ) * QsrcHist( SurfNum, 1 ) ) / ( Construct( ConstrNum ).CTFOutside( 0 ) + HcExtSurf( SurfNum ) + HRad );
-		}
-		// Outside heat balance case: No movable insulation, quick conduction
-	} else if ( ( ! MovInsulPresent ) && ( QuickConductionSurf ) ) {
-		if ( Surface( SurfNum ).OSCMPtr == 0 ) {
-			TH11 = ( -CTFConstOutPart( SurfNum ) + QRadSWOutAbs( SurfNum ) + ( HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) ) * TempExt + HSkyExtSurf( SurfNum ) * SkyTemp + HGrdExtSurf( SurfNum ) * OutDryBulbTemp + Construct( ConstrNum ).CTFSourceOut( 0 ) * QsrcHist( SurfNum, 1 ) + F1 * ( CTFConstInPart( SurfNum ) + QRadSWInAbs( SurfNum ) + QRadThermInAbs( SurfNum ) + Construct( ConstrNum ).CTFSourceIn( 0 ) * QsrcHist( SurfNum, 1 ) + HConvIn( SurfNum ) * MAT( ZoneNum ) + NetLWRadToSurf( SurfNum ) ) ) / ( Construct( ConstrNum ).CTFOutside( 0 ) + HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) + HSkyExtSurf( SurfNum ) + HGrdExtSurf( SurfNum ) - F1 * Construct( ConstrNum ).CTFCross( 0 ) ); // ODB used to approx ground surface temp | MAT use here is problem for room air models
-			// Outside Heat Balance case: Other Side Conditions Model
-		} else { //( Surface(SurfNum)%OSCMPtr > 0 ) THEN
-			// local copies of variables for clarity in radiation terms
-			RadTemp = OSCM( Surface( SurfNum ).OSCMPtr ).TRad;
-			HRad = OSCM( Surface( SurfNum ).OSCMPtr ).HRad;
-			// patterned after "No movable insulation, quick conduction," but with new radiation terms and no sun,
-			TH11 = ( -CTFConstOutPart( SurfNum ) + HcExtSurf( SurfNum ) * TempExt + HRad * RadTemp + Construct( ConstrNum ).CTFSourceOut( 0 ) * QsrcHist( SurfNum, 1 ) + F1 * ( CTFConstInPart( SurfNum ) + QRadSWInAbs( SurfNum ) + QRadThermInAbs( SurfNum ) + Construct( ConstrNum ).CTFSourceIn( 0 ) * QsrcHist( SurfNum, 1 ) + HConvIn( SurfNum ) * MAT( ZoneNum ) + NetLWRadToSurf( SurfNum ) ) ) / ( Construct( ConstrNum ).CTFOutside( 0 ) + HcExtSurf( SurfNum ) + HRad - F1 * Construct( ConstrNum ).CTFCross( 0 ) ); // MAT use here is problem for room air models
+			// patterned after "No movable insulation," but with new radiation terms and no sun,
+			TH11 = ( CTFOutFaceCondConst( SurfNum ) + HcExtSurf( SurfNum ) * TempExt + HRad * RadTemp + Construct( ConstrNum ).CTFSourceOut( 0 ) * QsrcHist( SurfNum, 1 ) ) / ( CTFOutFaceCondCoef( SurfNum ) + HcExtSurf( SurfNum ) + HRad );
 		}
-		// Outside heat balance case: Movable insulation, slow conduction
-	} else if ( ( MovInsulPresent ) && ( ! QuickConductionSurf ) ) {
-
-		F2 = HMovInsul / ( HMovInsul + HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) + HSkyExtSurf( SurfNum ) + HGrdExtSurf( SurfNum ) );
-
-		TH11 = ( -CTFConstOutPart( SurfNum ) + QRadSWOutAbs( SurfNum ) + Construct( ConstrNum ).CTFCross( 0 ) * TempSurfIn( SurfNum ) + F2 * ( QRadSWOutMvIns( SurfNum ) + ( HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) ) * TempExt + HSkyExtSurf( SurfNum ) * SkyTemp + HGrdExtSurf( SurfNum ) * OutDryBulbTemp ) ) / ( Construct( ConstrNum ).CTFOutside( 0 ) + HMovInsul - F2 * HMovInsul ); // ODB used to approx ground surface temp
-
-		// Outside heat balance case: Movable insulation, quick conduction
-	} else if ( ( MovInsulPresent ) && ( QuickConductionSurf ) ) {
+		// Outside heat balance case: Movable insulation
+		// (CTFOutFaceCondConst carries no source terms here, see CalcCTFOutFaceCoupling)
+	} else {
 
 		F2 = HMovInsul / ( HMovInsul + HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) + HSkyExtSurf( SurfNum ) + HGrdExtSurf( SurfNum ) );
 
-		TH11 = ( -CTFConstOutPart( SurfNum ) + QRadSWOutAbs( SurfNum ) + F1 * ( CTFConstInPart( SurfNum ) + QRadSWInAbs( SurfNum ) + QRadThermInAbs( SurfNum ) + HConvIn( SurfNum ) * MAT( ZoneNum ) + NetLWRadToSurf( SurfNum ) ) + F2 * ( QRadSWOutMvIns( SurfNum ) + ( HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) ) * TempExt + HSkyExtSurf( SurfNum ) * SkyTemp + HGrdExtSurf( SurfNum ) * OutDryBulbTemp ) ) / ( Construct( ConstrNum ).CTFOutside( 0 ) + HMovInsul - F2 * HMovInsul - F1 * Construct( ConstrNum ).CTFCross( 0 ) ); // ODB used to approx ground surface temp
+		TH11 = ( CTFOutFaceCondConst( SurfNum ) + QRadSWOutAbs( SurfNum ) + F2 * ( QRadSWOutMvIns( SurfNum ) + ( HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) ) * TempExt + HSkyExtSurf( SurfNum ) * SkyTemp + HGrdExtSurf( SurfNum ) * OutDryBulbTemp ) ) / ( CTFOutFaceCondCoef( SurfNum ) + HMovInsul - F2 * HMovInsul ); // ODB used to approx ground surface temp
 
 	} // ...end of outside heat balance cases IF-THEN block
 
 	// multiply out linearized radiation coeffs for reporting
-	Real64 const HExtSurf_fac( -( HSkyExtSurf( SurfNum ) * ( TH11 - SkyTemp ) + HAirExtSurf( SurfNum ) * ( TH11 - TempExt ) + HGrdExtSurf( SurfNum ) * ( TH11 - OutDryBulbTemp ) ) );
-	QdotRadOutRep( SurfNum ) = Surface( SurfNum ).Area * HExtSurf_fac;
-	QdotRadOutRepPerArea( SurfNum ) = HExtSurf_fac;
-	QRadOutReport( SurfNum ) = QdotRadOutRep( SurfNum ) * SecInHour * TimeStepZone;
+	ReportOutsideSurfRadiation( SurfNum, TempExt );
 	// Set the radiant system heat balance coefficients if this surface is also a radiant system
 	if ( Construct( ConstrNum ).SourceSinkPresent ) {
 
@@ -5923,13 +8339,222 @@ CalcOutsideSurfTemp(
 }
 
 void
-CalcExteriorVentedCavity( int const SurfNum ) // index of surface
+CalcCTFOutFaceCoupling( Optional_int_const ZoneToResimulate ) // if passed in, then only calculate surfaces that have this zone
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Linearize the CTF conduction at the outside face of each exterior CTF surface, and of
+	// each eco roof whatever its conduction algorithm, as
+	// q = CTFOutFaceCondCoef * Tout - CTFOutFaceCondConst, for CalcOutsideSurfTemp,
+	// CalcOutsideSurfTempBatch and the eco roof models.
+
+	// METHODOLOGY EMPLOYED:
+	// For a "quick conduction" surface (cross CTF term > 0.01) the inside face heat balance is
+	// substituted, using the current inside face terms; otherwise the last inside surface
+	// temperature is used.  Everything used here is fixed for the outside heat balance pass,
+	// so it is done once per pass before the surface loop.
+	// The quick conduction relation includes the inside face source term CTFSourceIn(0)*QsrcHist,
+	// which the old "movable insulation, quick conduction" equation left out.  It is zero in every
+	// case that equation was used for: CTFSourceIn(0) is zero unless the construction has an
+	// embedded source, and movable insulation on a source construction stops the run with a fatal
+	// error in CalcOutsideSurfTemp.
+
+	// REFERENCES:
+	// na
+
+	// Using/Aliasing
+	using DataHeatBalance::HConvIn;
+	using DataHeatBalance::QRadThermInAbs;
+	using DataHeatBalFanSys::MAT;
+	using namespace DataHeatBalSurface;
+	using namespace DataSurfaces;
+	using HeatBalanceSurfaceManager::SurfZone;
+	using HeatBalanceSurfaceManager::SurfClass;
+	using HeatBalanceSurfaceManager::SurfHeatTransSurf;
+	using HeatBalanceSurfaceManager::SurfHeatTransferAlgorithm;
+	using HeatBalanceSurfaceManager::SurfExtBoundCond;
+	using HeatBalanceSurfaceManager::SurfExtEcoRoof;
+	using HeatBalanceSurfaceManager::SurfCTFOutside0;
+	using HeatBalanceSurfaceManager::SurfCTFInside0;
+	using HeatBalanceSurfaceManager::SurfCTFCross0;
+	using HeatBalanceSurfaceManager::SurfCTFSourceIn0;
+	using HeatBalanceSurfaceManager::CTFOutFaceCondConst;
+	using HeatBalanceSurfaceManager::CTFOutFaceCondCoef;
+	using HeatBalanceSurfaceManager::HeatBalanceParallelFor;
+
+	// Surfaces are independent: run on HeatBalanceThreads threads
+	HeatBalanceParallelFor( 1, TotSurfaces, [&]( int const SurfNum ) {
+
+		int const ZoneNum( SurfZone( SurfNum ) );
+		Real64 F1; // Intermediate calculation variable
+
+		if ( present( ZoneToResimulate ) ) {
+			if ( ( ZoneNum != ZoneToResimulate ) && ( AdjacentZoneToSurface( SurfNum ) != ZoneToResimulate ) ) return;
+		}
+
+		if ( ! SurfHeatTransSurf( SurfNum ) || ZoneNum == 0 ) return;
+		if ( SurfClass( SurfNum ) == SurfaceClass_Window || SurfClass( SurfNum ) == SurfaceClass_TDD_Dome ) return;
+		// Eco roofs use the relation for every conduction algorithm, as the green roof models always have
+		if ( SurfHeatTransferAlgorithm( SurfNum ) != HeatTransferModel_CTF && SurfHeatTransferAlgorithm( SurfNum ) != HeatTransferModel_EMPD && ! SurfExtEcoRoof( SurfNum ) ) return;
+		if ( SurfExtBoundCond( SurfNum ) != ExternalEnvironment && SurfExtBoundCond( SurfNum ) != OtherSideCoefCalcExt && SurfExtBoundCond( SurfNum ) != OtherSideCondModeledExt ) return;
+
+		if ( SurfCTFCross0( SurfNum ) > 0.01 ) {
+			F1 = SurfCTFCross0( SurfNum ) / ( SurfCTFInside0( SurfNum ) + HConvIn( SurfNum ) );
+			CTFOutFaceCondConst( SurfNum ) = -CTFConstOutPart( SurfNum ) + F1 * ( CTFConstInPart( SurfNum ) + QRadSWInAbs( SurfNum ) + QRadThermInAbs( SurfNum ) + SurfCTFSourceIn0( SurfNum ) * QsrcHist( SurfNum, 1 ) + HConvIn( SurfNum ) * MAT( ZoneNum ) + NetLWRadToSurf( SurfNum ) ); // MAT use here is problem for room air models
+		} else {
+			F1 = 0.0;
+			CTFOutFaceCondConst( SurfNum ) = -CTFConstOutPart( SurfNum ) + SurfCTFCross0( SurfNum ) * TempSurfIn( SurfNum );
+		}
+		CTFOutFaceCondCoef( SurfNum ) = SurfCTFOutside0( SurfNum ) - F1 * SurfCTFCross0( SurfNum );
+
+	} );
+
+}
+
+void
+CalcOutsideSurfTempBatch()
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Outside face heat balance of the surfaces CalcHeatBalanceOutsideSurf deferred to
+	// OutsideBatchSurf, with the outside face report terms.
+
+	// METHODOLOGY EMPLOYED:
+	// Same equation as the "no movable insulation" case of CalcOutsideSurfTemp without an
+	// other side conditions model, using the linearized outside face conduction
+	// (CalcCTFOutFaceCoupling), so the loop body is free of branches and construction lookups.
+	// Each surface only writes its own entries, so the list is split over HeatBalanceThreads threads.
+
+	// REFERENCES:
+	// na
+
+	// Using/Aliasing
+	using DataEnvironment::SkyTemp;
+	using DataEnvironment::OutDryBulbTemp;
+	using namespace DataHeatBalSurface;
+	using HeatBalanceSurfaceManager::SurfCTFSourceOut0;
+	using HeatBalanceSurfaceManager::CTFOutFaceCondConst;
+	using HeatBalanceSurfaceManager::CTFOutFaceCondCoef;
+	using HeatBalanceSurfaceManager::NumOutsideBatch;
+	using HeatBalanceSurfaceManager::OutsideBatchSurf;
+	using HeatBalanceSurfaceManager::OutsideBatchTempExt;
+	using HeatBalanceSurfaceManager::HeatBalanceParallelFor;
+
+	// Outside heat balance case: No movable insulation
+	HeatBalanceParallelFor( 1, NumOutsideBatch, [&]( int const Item ) {
+
+		int const SurfNum( OutsideBatchSurf( Item ) );
+		Real64 const TempExt( OutsideBatchTempExt( SurfNum ) ); // Exterior temperature boundary condition
+
+		TH( SurfNum, 1, 1 ) = ( CTFOutFaceCondConst( SurfNum ) + QRadSWOutAbs( SurfNum ) + ( HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) ) * TempExt + HSkyExtSurf( SurfNum ) * SkyTemp + HGrdExtSurf( SurfNum ) * OutDryBulbTemp + SurfCTFSourceOut0( SurfNum ) * QsrcHist( SurfNum, 1 ) ) / ( CTFOutFaceCondCoef( SurfNum ) + HcExtSurf( SurfNum ) + HAirExtSurf( SurfNum ) + HSkyExtSurf( SurfNum ) + HGrdExtSurf( SurfNum ) ); // ODB used to approx ground surface temp
+
+		ReportOutsideSurfRadiation( SurfNum, TempExt );
+		ReportOutsideSurfConvection( SurfNum );
+
+	} );
+
+}
+
+void
+ReportOutsideSurfRadiation(
+	int const SurfNum, // Surface number
+	Real64 const TempExt // Exterior temperature boundary condition
+)
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Outside face radiation report terms of a surface whose outside face temperature was just
+	// set by CalcOutsideSurfTemp or CalcOutsideSurfTempBatch.
+
+	// METHODOLOGY EMPLOYED:
+	// Multiplies out the linearized sky, air and ground radiation coefficients.
+
+	// REFERENCES:
+	// na
+
+	// Using/Aliasing
+	using DataGlobals::SecInHour;
+	using DataGlobals::TimeStepZone;
+	using DataEnvironment::SkyTemp;
+	using DataEnvironment::OutDryBulbTemp;
+	using namespace DataHeatBalSurface;
+	using HeatBalanceSurfaceManager::SurfArea;
+
+	Real64 const TH11( TH( SurfNum, 1, 1 ) );
+	Real64 const HExtSurf_fac( -( HSkyExtSurf( SurfNum ) * ( TH11 - SkyTemp ) + HAirExtSurf( SurfNum ) * ( TH11 - TempExt ) + HGrdExtSurf( SurfNum ) * ( TH11 - OutDryBulbTemp ) ) );
+	QdotRadOutRep( SurfNum ) = SurfArea( SurfNum ) * HExtSurf_fac;
+	QdotRadOutRepPerArea( SurfNum ) = HExtSurf_fac;
+	QRadOutReport( SurfNum ) = QdotRadOutRep( SurfNum ) * SecInHour * TimeStepZone;
+
+}
+
+void
+ReportOutsideSurfConvection( int const SurfNum ) // Surface number
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Outside face convection report terms of a surface after the outside heat balance,
+	// for CalcHeatBalanceOutsideSurf and CalcOutsideSurfTempBatch.
+
+	// METHODOLOGY EMPLOYED:
+	// na
+
+	// REFERENCES:
+	// na
+
+	// Using/Aliasing
+	using DataGlobals::SecInHour;
+	using DataGlobals::TimeStepZone;
+	using namespace DataHeatBalSurface;
+	using DataSurfaces::Surface;
+	using DataSurfaces::OSCM;
+	using HeatBalanceSurfaceManager::SurfArea;
+	using HeatBalanceSurfaceManager::SurfOSCMPtr;
+
+	QdotConvOutRep( SurfNum ) = -SurfArea( SurfNum ) * HcExtSurf( SurfNum ) * ( TH( SurfNum, 1, 1 ) - Surface( SurfNum ).OutDryBulbTemp );
+
+	if ( SurfOSCMPtr( SurfNum ) > 0 ) { // use OSCM boundary data
+		QdotConvOutRepPerArea( SurfNum ) = -OSCM( SurfOSCMPtr( SurfNum ) ).HConv * ( TH( SurfNum, 1, 1 ) - OSCM( SurfOSCMPtr( SurfNum ) ).TConv );
+	} else {
+		QdotConvOutRepPerArea( SurfNum ) = -HcExtSurf( SurfNum ) * ( TH( SurfNum, 1, 1 ) - Surface( SurfNum ).OutDryBulbTemp );
+	}
+
+	QConvOutReport( SurfNum ) = QdotConvOutRep( SurfNum ) * SecInHour * TimeStepZone;
+
+}
+
+void
+CalcExteriorVentedCavity( int const CavNum ) // index of exterior vented cavity
 {
 
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         B Griffith
 	//       DATE WRITTEN   January 2005
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, solved once per cavity with a convergence test
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -5938,6 +8563,9 @@ CalcExteriorVentedCavity( int const SurfNum ) // index of surface
 
 	// METHODOLOGY EMPLOYED:
 	// derived from CalcPassiveTranspiredCollector
+	// Called once per outside heat balance pass for each cavity (not once per surface behind it).
+	// The sequential baffle/air solution is repeated until the baffle and cavity air temperatures
+	// change by less than CavityTempConvergTol, up to MaxCavityIterations times.
 
 	// REFERENCES:
 	// na
@@ -5959,12 +8587,15 @@ CalcExteriorVentedCavity( int const SurfNum ) // index of surface
 	using DataSurfaces::OSCM;
 	//unused0909  USE DataHVACGlobals , ONLY: TimeStepSys
 	using ConvectionCoefficients::InitExteriorConvectionCoeff;
+	using HeatBalanceSurfaceManager::ExtVentCavIterations;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
 
 	// SUBROUTINE PARAMETER DEFINITIONS:
 	static std::string const BlankString;
+	int const MaxCavityIterations( 20 ); // Upper limit on sequential baffle/air solutions
+	Real64 const CavityTempConvergTol( 0.001 ); // Baffle and cavity air temperature change for convergence (C)
 
 	// INTERFACE BLOCK SPECIFICATIONS:
 	// DERIVED TYPE DEFINITIONS:
@@ -5975,6 +8606,8 @@ CalcExteriorVentedCavity( int const SurfNum ) // index of surface
 	Real64 AspRat; // Aspect Ratio of gap
 	Real64 TmpTscoll;
 	Real64 TmpTaPlen;
+	Real64 TscollPrev; // Baffle temperature from the previous iteration
+	Real64 TaPlenPrev; // Cavity air temperature from the previous iteration
 	Real64 RhoAir;
 	Real64 holeArea;
 	Real64 HrPlen;
@@ -5983,13 +8616,13 @@ CalcExteriorVentedCavity( int const SurfNum ) // index of surface
 	Real64 MdotVent;
 	Real64 VdotWind;
 	Real64 VdotThermal;
-	int CavNum; // do loop counter
+	int SurfNum; // surface used for the outdoor air conditions
 	int iter; // do loop counter
 	int thisOSCM;
 	Real64 TempExt;
 	Real64 OutHumRatExt;
 
-	CavNum = Surface( SurfNum ).ExtCavNum;
+	SurfNum = ExtVentedCavity( CavNum ).SurfPtrs( 1 );
 
 	TempExt = Surface( SurfNum ).OutDryBulbTemp;
 
@@ -6005,11 +8638,18 @@ CalcExteriorVentedCavity( int const SurfNum ) // index of surface
 
 	// all the work is done in this routine located in GeneralRoutines.cc
 
-	for ( iter = 1; iter <= 3; ++iter ) { // this is a sequential solution approach.
+	for ( iter = 1; iter <= MaxCavityIterations; ++iter ) { // this is a sequential solution approach.
+
+		TscollPrev = TmpTscoll;
+		TaPlenPrev = TmpTaPlen;
 
 		CalcPassiveExteriorBaffleGap( ExtVentedCavity( CavNum ).SurfPtrs, holeArea, ExtVentedCavity( CavNum ).Cv, ExtVentedCavity( CavNum ).Cd, ExtVentedCavity( CavNum ).HdeltaNPL, ExtVentedCavity( CavNum ).SolAbsorp, ExtVentedCavity( CavNum ).LWEmitt, ExtVentedCavity( CavNum ).Tilt, AspRat, ExtVentedCavity( CavNum ).PlenGapThick, ExtVentedCavity( CavNum ).BaffleRoughness, ExtVentedCavity( CavNum ).QdotSource, TmpTscoll, TmpTaPlen, HcPlen, HrPlen, Isc, MdotVent, VdotWind, VdotThermal );
 
+		if ( std::abs( TmpTscoll - TscollPrev ) < CavityTempConvergTol && std::abs( TmpTaPlen - TaPlenPrev ) < CavityTempConvergTol ) break;
+
 	} // sequential solution
+	ExtVentCavIterations( CavNum ) = min( iter, MaxCavityIterations );
+
 	//now fill results into derived types
 	ExtVentedCavity( CavNum ).Isc = Isc;
 	ExtVentedCavity( CavNum ).TAirCav = TmpTaPlen;
@@ -1,7 +1,17 @@
 #ifndef HeatBalanceSurfaceManager_hh_INCLUDED
 #define HeatBalanceSurfaceManager_hh_INCLUDED
 
+// C++ Headers
+#include <algorithm>
+#include <chrono>
+#include <iosfwd>
+#include <string>
+
 // ObjexxFCL Headers
+#include <ObjexxFCL/FArray.hh>
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
+#include <ObjexxFCL/FArray3D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -13,13 +23,312 @@ namespace HeatBalanceSurfaceManager {
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS:
-	// na
+	// Heat balance phases timed by StartHeatBalancePhase/EndHeatBalancePhase
+	extern int const PhaseInitSurfaceHeatBalance;
+	extern int const PhaseOutsideSurf;
+	extern int const PhaseInsideSurf;
+	extern int const PhaseThermalHistories;
+	extern int const PhaseGreenRoof; // Nested in PhaseOutsideSurf
+	extern int const NumHeatBalancePhases;
+	extern FArray1D_string const HeatBalancePhaseNames;
+	// Hardware counters sampled around the phases (builds with EP_HeatBalancePerfCounters on Linux)
+	extern int const CounterCycles;
+	extern int const CounterInstructions;
+	extern int const CounterL1DMisses;
+	extern int const CounterLLCMisses;
+	extern int const CounterBranchMisses;
+	extern int const NumPhaseCounters;
+	// Loop iterations per chunk of HeatBalanceParallelChunks; fixed so results do not depend on the thread count
+	extern int const HeatBalanceChunkSize;
+	// Header of a checkpoint file (WriteHeatBalanceCheckpoint); the version changes with the layout
+	extern std::string const HeatBalanceCheckpointMagic;
+	extern int const HeatBalanceCheckpointVersion;
+	// Members of HeatBalanceCheckpoint, written to the checkpoint header: arrays, then green roof
+	// scalars.  Update them with the struct and with every routine that lists its members.
+	extern int const HeatBalanceCheckpointNumArrays;
+	extern int const HeatBalanceCheckpointNumScalars;
+	// Header of a surface heat balance capture file (WriteSurfaceHeatBalanceCapture)
+	extern std::string const SurfaceHeatBalanceCaptureMagic;
 
 	// DERIVED TYPE DEFINITIONS:
-	// na
+
+	// Heat balance state at the end of a zone timestep: the conduction histories and the master
+	// history interpolation state, the face temperatures and inside iteration state, the zone air
+	// state and the green roof state of both green roof models.  A simulation resumed from it
+	// continues as if it had run up to that point.
+	struct HeatBalanceCheckpoint
+	{
+		// Members
+		FArray3D< Real64 > TH; // Temperature histories (surface, term, side)
+		FArray3D< Real64 > QH; // Flux histories (surface, term, side)
+		FArray3D< Real64 > THM; // Master temperature histories (surface, term, side)
+		FArray3D< Real64 > QHM; // Master flux histories (surface, term, side)
+		FArray2D< Real64 > TsrcHist; // Source/sink temperature histories (surface, term)
+		FArray2D< Real64 > QsrcHist; // Source/sink flux histories (surface, term)
+		FArray2D< Real64 > TsrcHistM; // Master source/sink temperature histories (surface, term)
+		FArray2D< Real64 > QsrcHistM; // Master source/sink flux histories (surface, term)
+		FArray1D_int SUMH; // Zone timesteps into the current master history step
+		FArray1D< Real64 > SumTime; // Time from the start of the master history step [h]
+		FArray1D< Real64 > QExt1; // Outside face flux of the first step of the master history step [W/m2]
+		FArray1D< Real64 > QInt1; // Inside face flux of the first step of the master history step [W/m2]
+		FArray1D< Real64 > TempExt1; // Outside face temperature of the first step of the master history step [C]
+		FArray1D< Real64 > TempInt1; // Inside face temperature of the first step of the master history step [C]
+		FArray1D< Real64 > Qsrc1; // Source/sink flux of the first step of the master history step [W/m2]
+		FArray1D< Real64 > Tsrc1; // Source/sink temperature of the first step of the master history step [C]
+		FArray1D< Real64 > TempSurfIn; // Inside face temperatures [C]
+		FArray1D< Real64 > TempSurfInTmp; // Inside face temperatures of the last iteration [C]
+		FArray1D< Real64 > TempSurfOut; // Outside face temperatures [C]
+		FArray1D< Real64 > TempInsOld; // Inside face temperatures of the previous inside iteration [C]
+		FArray1D< Real64 > RefAirTemp; // Inside face reference air temperatures [C]
+		FArray1D< Real64 > HConvInEvalDelTemp; // Surface minus zone air temperature at the last HConvIn evaluation [C]
+		FArray1D< Real64 > MAT; // Zone mean air temperatures [C]
+		FArray1D< Real64 > ZT; // Zone air temperatures at the end of the timestep [C]
+		FArray1D< Real64 > ZTAV; // Zone air temperatures averaged over the timestep [C]
+		FArray1D< Real64 > XMAT; // Zone air temperature history, 1 step back [C]
+		FArray1D< Real64 > XM2T; // Zone air temperature history, 2 steps back [C]
+		FArray1D< Real64 > XM3T; // Zone air temperature history, 3 steps back [C]
+		FArray1D< Real64 > XM4T; // Zone air temperature history, 4 steps back [C]
+		FArray1D< Real64 > XMPT; // Zone air temperature at the previous system timestep [C]
+		FArray1D< Real64 > ZoneTMX; // Zone air temperature of the analytical solution [C]
+		FArray1D< Real64 > ZoneTM2; // Zone air temperature of the analytical solution, 2 steps back [C]
+		FArray1D< Real64 > ZoneAirHumRat; // Zone air humidity ratios [kg/kg]
+		FArray1D< Real64 > ZoneAirHumRatAvg; // Zone air humidity ratios averaged over the timestep [kg/kg]
+		FArray1D< Real64 > ZoneAirHumRatOld; // Zone air humidity ratios of the previous timestep [kg/kg]
+		Real64 SoilMoisture; // Near-surface soil moisture of CalcEcoRoof (m^3/m^3)
+		Real64 RootMoisture; // Root zone soil moisture of CalcEcoRoof (m^3/m^3)
+		Real64 LeafTempPrev; // Leaf temperature of the previous timestep of CalcEcoRoof [C]
+		Real64 GroundTempPrev; // Ground temperature of the previous timestep of CalcEcoRoof [C]
+		Real64 LeafVaporFlux; // Vegetation evapotranspiration rate of CalcEcoRoof [m/s]
+		Real64 GroundVaporFlux; // Ground evapotranspiration rate of CalcEcoRoof [m/s]
+		Real64 PlantCoverSoilMoisture; // Near-surface soil moisture of GreenRoof_with_PlantCoverage (m^3/m^3)
+		Real64 PlantCoverRootMoisture; // Root zone soil moisture of GreenRoof_with_PlantCoverage (m^3/m^3)
+		Real64 PlantCoverLeafVaporFlux; // Vegetation evapotranspiration rate of GreenRoof_with_PlantCoverage [m/s]
+		Real64 PlantCoverGroundVaporFlux; // Ground evapotranspiration rate of GreenRoof_with_PlantCoverage [m/s]
+		Real64 PlantTemp; // Plant temperature of GreenRoof_with_PlantCoverage [K]
+		Real64 SoilTemp; // Soil temperature under the plants of GreenRoof_with_PlantCoverage [K]
+		Real64 BareSoilTemp; // Bare soil temperature of GreenRoof_with_PlantCoverage [K]
+		Real64 AvgSoilTemp; // Average soil temperature of GreenRoof_with_PlantCoverage [K]
+		Real64 CumRunoff; // Green roof cumulative runoff [m]
+		Real64 CumET; // Green roof cumulative evapotranspiration [m]
+		Real64 CumPrecip; // Green roof cumulative precipitation [m]
+		Real64 CumIrrigation; // Green roof cumulative irrigation [m]
+
+		// Default Constructor
+		HeatBalanceCheckpoint() :
+			SoilMoisture( 0.0 ),
+			RootMoisture( 0.0 ),
+			LeafTempPrev( 0.0 ),
+			GroundTempPrev( 0.0 ),
+			LeafVaporFlux( 0.0 ),
+			GroundVaporFlux( 0.0 ),
+			PlantCoverSoilMoisture( 0.0 ),
+			PlantCoverRootMoisture( 0.0 ),
+			PlantCoverLeafVaporFlux( 0.0 ),
+			PlantCoverGroundVaporFlux( 0.0 ),
+			PlantTemp( 0.0 ),
+			SoilTemp( 0.0 ),
+			BareSoilTemp( 0.0 ),
+			AvgSoilTemp( 0.0 ),
+			CumRunoff( 0.0 ),
+			CumET( 0.0 ),
+			CumPrecip( 0.0 ),
+			CumIrrigation( 0.0 )
+		{}
+	};
+
+	// Inputs of CalcHeatBalanceOutsideSurf and CalcHeatBalanceInsideSurf at one zone timestep and
+	// the face temperatures they produced, for replaying the surface heat balance in isolation
+	// (ReplaySurfaceHeatBalance)
+	struct SurfaceHeatBalanceCapture
+	{
+		// Members
+		HeatBalanceCheckpoint State; // Histories, face temperatures, zone air and green roof state
+		FArray1D< Real64 > CTFConstOutPart; // Outside face CTF history terms [W/m2]
+		FArray1D< Real64 > CTFConstInPart; // Inside face CTF history terms [W/m2]
+		FArray1D< Real64 > QRadSWOutAbs; // Absorbed outside face short-wave radiation [W/m2]
+		FArray1D< Real64 > QRadSWInAbs; // Absorbed inside face short-wave radiation [W/m2]
+		FArray1D< Real64 > QRadThermInAbs; // Absorbed inside face internal long-wave radiation [W/m2]
+		FArray1D< Real64 > QRadSWOutMvIns; // Short-wave radiation absorbed by exterior movable insulation [W/m2]
+		FArray1D< Real64 > HConvIn; // Inside face convection coefficients [W/m2-K]
+		FArray1D< Real64 > TempEffBulkAir; // Inside face adjacent air temperatures [C]
+		FArray2D< Real64 > QRadSWwinAbs; // Short-wave radiation absorbed by window layers [W/m2]
+		FArray1D< Real64 > SurfOutDryBulbTemp; // Surface( SurfNum ).OutDryBulbTemp [C]
+		FArray1D< Real64 > SurfOutWetBulbTemp; // Surface( SurfNum ).OutWetBulbTemp [C]
+		FArray1D< Real64 > SurfWindSpeed; // Surface( SurfNum ).WindSpeed [m/s]
+		FArray2D< Real64 > TempSurfInHist; // Converged inside face temperatures of the last three zone timesteps [C]
+		int NumTempSurfInHist; // Number of valid timesteps held in TempSurfInHist
+		bool TempSurfInPredictPending; // True until the first full inside heat balance of the timestep
+		FArray1D< Real64 > NetLWRadToSurf; // Net interior long-wave radiation to the inside faces [W/m2]
+		Real64 OutDryBulbTemp; // Outdoor dry-bulb temperature [C]
+		Real64 OutWetBulbTemp; // Outdoor wet-bulb temperature [C]
+		Real64 OutHumRat; // Outdoor humidity ratio [kg/kg]
+		Real64 OutBaroPress; // Outdoor barometric pressure [Pa]
+		Real64 WindSpeed; // Wind speed [m/s]
+		Real64 WindDir; // Wind direction [deg]
+		Real64 SkyTemp; // Sky temperature [C]
+		Real64 BeamSolarRad; // Direct normal solar irradiance [W/m2]
+		Real64 DifSolarRad; // Diffuse horizontal solar irradiance [W/m2]
+		bool IsRain; // True if it is raining
+		FArray1D< Real64 > TempSurfInRef; // Inside face temperatures the captured timestep produced [C]
+		FArray1D< Real64 > TempSurfOutRef; // Outside face temperatures the captured timestep produced [C]
+		FArray1D< Real64 > NetLWRadToSurfRef; // Net interior long-wave radiation the captured timestep produced [W/m2]
+
+		// Default Constructor
+		SurfaceHeatBalanceCapture() :
+			NumTempSurfInHist( 0 ),
+			TempSurfInPredictPending( false ),
+			OutDryBulbTemp( 0.0 ),
+			OutWetBulbTemp( 0.0 ),
+			OutHumRat( 0.0 ),
+			OutBaroPress( 0.0 ),
+			WindSpeed( 0.0 ),
+			WindDir( 0.0 ),
+			SkyTemp( 0.0 ),
+			BeamSolarRad( 0.0 ),
+			DifSolarRad( 0.0 ),
+			IsRain( false )
+		{}
+	};
+
+	// Blind properties of a window interpolated at its slat angle (GetBlindSlatAngProperties)
+	struct BlindSlatAngProperties
+	{
+		// Members
+		bool Evaluated; // True once the blind properties have been evaluated
+		int BlindNumber; // Blind they were evaluated for
+		Real64 SlatAng; // Slat angle they were evaluated at [rad]
+		int ConstrNumSh; // Shaded construction the construction properties were evaluated for (0 = none)
+		Real64 EffShBlindEmiss; // Effective inside blind emissivity
+		Real64 EffGlassEmiss; // Effective inside glass emissivity with the blind in place
+		Real64 IRBackTrans; // Blind back IR transmittance
+		Real64 SolBackDiffDiffTrans; // Blind back diffuse-diffuse solar transmittance
+		Real64 SolFrontDiffDiffTrans; // Blind front diffuse-diffuse solar transmittance
+		Real64 BlTransDiff; // Diffuse solar transmittance of the construction with the blind
+		Real64 AbsDiffBlind; // Front diffuse solar absorptance of the blind
+		Real64 AbsDiffBlindGnd; // Front ground diffuse solar absorptance of the blind
+		Real64 AbsDiffBlindSky; // Front sky diffuse solar absorptance of the blind
+		Real64 AbsDiffBackBlind; // Back diffuse solar absorptance of the blind
+		FArray1D< Real64 > BlAbsDiff; // Front diffuse solar absorptance of each glass layer
+		FArray1D< Real64 > BlAbsDiffGnd; // Front ground diffuse solar absorptance of each glass layer
+		FArray1D< Real64 > BlAbsDiffSky; // Front sky diffuse solar absorptance of each glass layer
+		FArray1D< Real64 > BlAbsDiffBack; // Back diffuse solar absorptance of each glass layer
+
+		// Default Constructor
+		BlindSlatAngProperties() :
+			Evaluated( false ),
+			BlindNumber( 0 ),
+			SlatAng( 0.0 ),
+			ConstrNumSh( 0 ),
+			EffShBlindEmiss( 0.0 ),
+			EffGlassEmiss( 0.0 ),
+			IRBackTrans( 0.0 ),
+			SolBackDiffDiffTrans( 0.0 ),
+			SolFrontDiffDiffTrans( 0.0 ),
+			BlTransDiff( 0.0 ),
+			AbsDiffBlind( 0.0 ),
+			AbsDiffBlindGnd( 0.0 ),
+			AbsDiffBlindSky( 0.0 ),
+			AbsDiffBackBlind( 0.0 )
+		{}
+	};
 
 	// MODULE VARIABLE DECLARATIONS:
-	// na
+	extern FArray1D_int ExtVentCavIterations; // Baffle/cavity solution iterations of each exterior vented cavity (last solve)
+	extern FArray1D_bool ExtVentCavSolved; // True once an exterior vented cavity has been solved in the current outside pass
+
+	// Compact copies of the SurfaceData fields read by the surface heat balance loops;
+	// set by InitSurfaceHotFields, with SurfConstruction kept current by InitEMSControlledConstructions
+	extern FArray1D_int SurfZone; // Surface( SurfNum ).Zone
+	extern FArray1D_int SurfClass; // Surface( SurfNum ).Class
+	extern FArray1D_bool SurfHeatTransSurf; // Surface( SurfNum ).HeatTransSurf
+	extern FArray1D_int SurfHeatTransferAlgorithm; // Surface( SurfNum ).HeatTransferAlgorithm
+	extern FArray1D_int SurfExtBoundCond; // Surface( SurfNum ).ExtBoundCond
+	extern FArray1D_int SurfConstruction; // Surface( SurfNum ).Construction
+	extern FArray1D< Real64 > SurfArea; // Surface( SurfNum ).Area
+	extern FArray1D_bool SurfExtEcoRoof; // Surface( SurfNum ).ExtEcoRoof
+	extern FArray1D_int SurfOSCMPtr; // Surface( SurfNum ).OSCMPtr
+	extern int NumCondFDSurf; // Number of surfaces in CondFDSurf
+	extern FArray1D_int CondFDSurf; // Heat transfer surfaces using the finite difference (CondFD) algorithm
+	extern int NumWindowSurf; // Number of surfaces in WindowSurf
+	extern FArray1D_int WindowSurf; // Window and TDD dome surfaces, the only ones whose SurfaceWindow terms are set
+	extern bool SunDownSolarZeroed; // Solar quantities set only while the sun is up were zeroed at a sun-down timestep
+	extern FArray1D< BlindSlatAngProperties > SurfWinBlindProps; // Blind properties of each window at its current slat angle
+
+	// Inputs of ComputeIntThermalAbsorpFactors when each surface's zone was last evaluated
+	extern FArray1D_bool IntThermalAbsorpZoneDirty; // ITABSF and TMULT of the zone must be re-evaluated
+	extern FArray1D_int IntThermalAbsorpConstr; // Surface( SurfNum ).Construction
+	extern FArray1D_int IntThermalAbsorpShadeFlag; // SurfaceWindow( SurfNum ).ShadingFlag
+	extern FArray1D_int IntThermalAbsorpConstrSh; // SurfaceWindow( SurfNum ).ShadedConstruction
+	extern FArray1D_int IntThermalAbsorpBlindNum; // SurfaceWindow( SurfNum ).BlindNumber
+	extern FArray1D< Real64 > IntThermalAbsorpSlatAng; // SurfaceWindow( SurfNum ).SlatAngThisTS [rad]
+	extern FArray1D< Real64 > IntThermalAbsorpSwitchFac; // SurfaceWindow( SurfNum ).SwitchingFactor
+	extern FArray1D_bool IntThermalAbsorpMovInsul; // True if exterior movable insulation is present
+
+	// Zero-term CTF coefficients of each surface's construction, refreshed each timestep by InitSurfaceCTFZeroTerms
+	extern FArray1D< Real64 > SurfCTFOutside0; // Construct( SurfConstruction ).CTFOutside( 0 )
+	extern FArray1D< Real64 > SurfCTFInside0; // Construct( SurfConstruction ).CTFInside( 0 )
+	extern FArray1D< Real64 > SurfCTFCross0; // Construct( SurfConstruction ).CTFCross( 0 )
+	extern FArray1D< Real64 > SurfCTFSourceOut0; // Construct( SurfConstruction ).CTFSourceOut( 0 )
+	extern FArray1D< Real64 > SurfCTFSourceIn0; // Construct( SurfConstruction ).CTFSourceIn( 0 )
+
+	// Linearized conduction at the outside face of exterior CTF surfaces, set each outside heat balance
+	// pass by CalcCTFOutFaceCoupling: conduction from the outside face into the construction is
+	// CTFOutFaceCondCoef * TH(SurfNum,1,1) - CTFOutFaceCondConst
+	extern FArray1D< Real64 > CTFOutFaceCondConst; // Part independent of the outside face temperature [W/m2]
+	extern FArray1D< Real64 > CTFOutFaceCondCoef; // Coefficient of the outside face temperature [W/m2-K]
+
+	// Exterior CTF surfaces without movable insulation, other side conditions model or internal source
+	// whose outside face temperature is evaluated after the surface loop by CalcOutsideSurfTempBatch
+	extern int NumOutsideBatch; // Number of surfaces in OutsideBatchSurf
+	extern FArray1D_int OutsideBatchSurf; // Surface numbers of the deferred surfaces
+	extern FArray1D< Real64 > OutsideBatchTempExt; // Exterior temperature boundary condition of a deferred surface
+
+	// Master history interpolation state of UpdateThermalHistories
+	extern FArray1D< Real64 > QExt1; // Heat flux at the exterior surface during first time step/series
+	extern FArray1D< Real64 > QInt1; // Heat flux at the interior surface during first time step/series
+	extern FArray1D< Real64 > TempInt1; // Temperature of interior surface during first time step/series
+	extern FArray1D< Real64 > TempExt1; // Temperature of exterior surface during first time step/series
+	extern FArray1D< Real64 > Qsrc1; // Heat source/sink (during first time step/series)
+	extern FArray1D< Real64 > Tsrc1; // Temperature at source/sink (during first time step/series)
+	extern FArray1D< Real64 > SumTime; // Amount of time that has elapsed from start of master history to the current time step
+
+	// Iteration state of CalcHeatBalanceInsideSurf
+	extern FArray1D< Real64 > TempInsOld; // Holds previous iteration's value for convergence check
+	extern FArray1D< Real64 > RefAirTemp; // reference air temperatures
+
+	// Inside face temperature predictor (InsideSurfTempPredictor) and iteration statistics
+	extern FArray2D< Real64 > TempSurfInHist; // Converged TempSurfIn of the last three zone timesteps (surface, 1 = latest)
+	extern int NumTempSurfInHist; // Number of valid timesteps held in TempSurfInHist
+	extern bool TempSurfInPredictPending; // True until the first full inside heat balance of the timestep
+	extern FArray1D_bool TempSurfInPredicted; // True if the surface started the timestep from an extrapolated temperature
+	extern int InsideSurfPredictorFallbacks; // Surfaces restarted from their last converged temperature this timestep
+	extern Real64 InsideSurfIterSum; // Iterations of the full inside heat balances of this environment (no warmup)
+	extern int InsideSurfSolveCount; // Number of full inside heat balances counted in InsideSurfIterSum
+	extern int InsideSurfFallbackSum; // Predictor fallbacks counted over the same heat balances
+
+	// Change-driven re-evaluation of the inside convection coefficients in CalcHeatBalanceInsideSurf
+	extern FArray1D< Real64 > HConvInEvalDelTemp; // Surface minus zone air temperature at the last HConvIn evaluation [C]
+	extern int HConvInEvalCount; // Inside convection coefficients re-evaluated during this timestep's iterations
+	extern int HConvInSkipCount; // Inside convection coefficient re-evaluations skipped during this timestep
+
+	// Phase timing of the surface heat balance, reported and reset at the end of each environment
+	extern FArray1D< Real64 > HeatBalancePhaseTime; // Time spent in each phase [s]
+	extern FArray1D_int HeatBalancePhaseCalls; // Number of times each phase was entered
+	extern int HeatBalancePhaseSteps; // Calls of ManageSurfaceHeatBalance timed in this environment
+	extern bool HeatBalancePhaseCountersActive; // True if the hardware counters could be opened
+	extern FArray2D< Real64 > HeatBalancePhaseCounters; // Counts accumulated in each phase (counter, phase)
+
+	// Threads used by the parallel surface and zone loops (InitHeatBalanceThreads)
+	extern int HeatBalanceThreads;
+
+	// Surface heat balance capture and replay (Output:SurfaceHeatBalanceCapture)
+	extern SurfaceHeatBalanceCapture SurfaceCapture; // Capture being taken or replayed
+	extern bool SurfaceCaptureDone; // True once the capture was written or replayed
+
+	// Trace-event timeline of the heat balance (InitHeatBalanceTrace)
+	extern bool HeatBalanceTraceActive; // True if trace events are being written
+	extern int HeatBalanceTraceEveryN; // Keep every Nth zone timestep (0 = none by count)
+	extern Real64 HeatBalanceTraceMinDuration; // Also keep zone timesteps at least this long (0 = off) [us]
 
 	// Subroutine Specifications for the Heat Balance Module
 	// Driver Routines
@@ -61,6 +370,12 @@ namespace HeatBalanceSurfaceManager {
 	void
 	InitIntSolarDistribution();
 
+	BlindSlatAngProperties const &
+	GetBlindSlatAngProperties(
+		int const SurfNum, // Window surface with a blind
+		int const ConstrNumSh // Shaded construction in use, or 0 if only the blind properties are needed
+	);
+
 	void
 	ComputeIntThermalAbsorpFactors();
 
@@ -76,6 +391,12 @@ namespace HeatBalanceSurfaceManager {
 	void
 	InitEMSControlledConstructions();
 
+	void
+	InitSurfaceHotFields();
+
+	void
+	InitSurfaceCTFZeroTerms();
+
 	// End Initialization Section of the Module
 	//******************************************************************************
 
@@ -91,6 +412,123 @@ namespace HeatBalanceSurfaceManager {
 	void
 	UpdateThermalHistories();
 
+	void
+	UpdateInsideSurfTempHistory();
+
+	void
+	ManageHeatBalanceCheckpoints();
+
+	void
+	CaptureHeatBalanceCheckpoint( HeatBalanceCheckpoint & State ); // State filled from the current simulation
+
+	void
+	RestoreHeatBalanceCheckpoint( HeatBalanceCheckpoint const & State ); // State to continue the simulation from
+
+	void
+	WriteHeatBalanceCheckpoint(
+		HeatBalanceCheckpoint const & State, // State to write
+		std::string const & FileName // Checkpoint file
+	);
+
+	void
+	ReadHeatBalanceCheckpoint(
+		std::string const & FileName, // Checkpoint file
+		HeatBalanceCheckpoint & State, // State read from the file
+		bool & ErrorsFound // Set to true if the file cannot be read or does not match this input
+	);
+
+	void
+	WriteCheckpointState(
+		std::ofstream & CheckpointFile, // Open checkpoint file, header written
+		HeatBalanceCheckpoint const & State // State to write
+	);
+
+	bool
+	ReadCheckpointState(
+		std::ifstream & CheckpointFile, // Open checkpoint file, header read
+		HeatBalanceCheckpoint & State // State read from the file
+	);
+
+	void
+	WriteCheckpointHeader(
+		std::ofstream & CheckpointFile, // Open checkpoint file
+		std::string const & Magic, // HeatBalanceCheckpointMagic or SurfaceHeatBalanceCaptureMagic
+		HeatBalanceCheckpoint const & State // State about to be written
+	);
+
+	bool
+	ReadCheckpointHeader(
+		std::ifstream & CheckpointFile, // Open checkpoint file
+		std::string const & Magic // Magic the file must start with
+	);
+
+	void
+	WriteCheckpointArray(
+		std::ofstream & CheckpointFile, // Open checkpoint file
+		FArray< Real64 > const & Values // Array to write
+	);
+
+	void
+	WriteCheckpointArray(
+		std::ofstream & CheckpointFile, // Open checkpoint file
+		FArray< int > const & Values // Array to write
+	);
+
+	bool
+	ReadCheckpointArray(
+		std::ifstream & CheckpointFile, // Open checkpoint file
+		FArray< Real64 > & Values // Dimensioned array to read into
+	);
+
+	bool
+	ReadCheckpointArray(
+		std::ifstream & CheckpointFile, // Open checkpoint file
+		FArray< int > & Values // Dimensioned array to read into
+	);
+
+	void
+	CaptureSurfaceHeatBalance( SurfaceHeatBalanceCapture & Capture ); // Capture filled from the current timestep
+
+	void
+	RestoreSurfaceHeatBalance( SurfaceHeatBalanceCapture const & Capture ); // Capture to make current
+
+	void
+	WriteSurfaceHeatBalanceCapture(
+		SurfaceHeatBalanceCapture const & Capture, // Capture to write
+		std::string const & FileName // Capture file
+	);
+
+	void
+	ReadSurfaceHeatBalanceCapture(
+		std::string const & FileName, // Capture file
+		SurfaceHeatBalanceCapture & Capture, // Capture read from the file
+		bool & ErrorsFound // Set to true if the file cannot be read or does not match this input
+	);
+
+	bool
+	IsSurfaceHeatBalanceCaptureStep();
+
+	void
+	StartSurfaceHeatBalanceCapture();
+
+	void
+	FinishSurfaceHeatBalanceCapture();
+
+	void
+	ReplaySurfaceHeatBalance(
+		SurfaceHeatBalanceCapture const & Capture, // Captured inputs and face temperatures of a surface heat balance
+		int const NumRepeats, // Number of times the surface heat balance is repeated
+		bool & BitIdentical, // True if every repetition reproduced the captured face temperatures and long-wave radiation
+		Real64 & MaxTempDiff, // Largest face temperature difference of the first repetition that differs [deltaC]
+		Real64 & NsPerSurface // Average time of one outside plus inside heat balance per surface [ns]
+	);
+
+	void
+	ReportCheckpointDifferences(
+		HeatBalanceCheckpoint const & Reference, // State of the reference (serial) simulation
+		std::string const & Label // Identifies the chunk boundary in the report
+	);
+
 	void
 	CalculateZoneMRT( Optional_int_const ZoneToResimulate = _ ); // if passed in, then only calculate surfaces that have this zone
 
@@ -103,6 +541,83 @@ namespace HeatBalanceSurfaceManager {
 	void
 	ReportSurfaceHeatBalance();
 
+	void
+	ReportInsideSurfIterations();
+
+	void
+	InitHeatBalancePhaseCounters();
+
+	bool
+	ReadHeatBalancePhaseCounters( FArray1D< Real64 > & Values ); // Current counts, one per counter
+
+	void
+	StartHeatBalancePhase( int const Phase ); // PhaseInitSurfaceHeatBalance, ...
+
+	void
+	EndHeatBalancePhase( int const Phase ); // Phase passed to StartHeatBalancePhase
+
+	void
+	ReportHeatBalancePhases();
+
+	void
+	ReportHeatBalanceScaling();
+
+	void
+	InitHeatBalanceThreads();
+
+	// Runs Body( Chunk, ChunkFirst, ChunkLast ) for consecutive chunks of HeatBalanceChunkSize iterations
+	// covering First..Last.  Chunks are handed to HeatBalanceThreads threads as they become free; the
+	// chunk boundaries depend only on the range, so per-chunk partial results are the same for any
+	// thread count.  Body must only write data owned by its iterations.
+	template< typename ChunkBody >
+	void
+	HeatBalanceParallelChunks(
+		int const First, // First loop index
+		int const Last, // Last loop index
+		ChunkBody const & Body // Work on one chunk
+	)
+	{
+		if ( Last < First ) return;
+		int const NumChunks( ( Last - First ) / HeatBalanceChunkSize + 1 );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic, 1 ) num_threads( HeatBalanceThreads ) if ( HeatBalanceThreads > 1 && NumChunks > 1 )
+#endif
+		for ( int Chunk = 1; Chunk <= NumChunks; ++Chunk ) {
+			int const ChunkFirst( First + ( Chunk - 1 ) * HeatBalanceChunkSize );
+			Body( Chunk, ChunkFirst, std::min( ChunkFirst + HeatBalanceChunkSize - 1, Last ) );
+		}
+	}
+
+	// Runs Body( Index ) for Index = First..Last on HeatBalanceThreads threads
+	template< typename IndexBody >
+	void
+	HeatBalanceParallelFor(
+		int const First, // First loop index
+		int const Last, // Last loop index
+		IndexBody const & Body // Work on one index
+	)
+	{
+		HeatBalanceParallelChunks( First, Last, [&]( int const, int const ChunkFirst, int const ChunkLast ) {
+			for ( int Index = ChunkFirst; Index <= ChunkLast; ++Index ) Body( Index );
+		} );
+	}
+
+	void
+	InitHeatBalanceTrace();
+
+	std::chrono::steady_clock::time_point
+	HeatBalanceTraceMark();
+
+	void
+	HeatBalanceTraceSpan(
+		std::string const & Name, // Span name shown by the trace viewer
+		std::chrono::steady_clock::time_point const StartTime, // HeatBalanceTraceMark at the start of the span
+		bool const Sampled = true // False for spans written regardless of the timestep sampling
+	);
+
+	void
+	EndHeatBalanceTraceStep( std::chrono::steady_clock::time_point const StartTime ); // Start of the zone timestep
+
 	// End of Reporting subroutines for the HB Module
 	// *****************************************************************************
 
@@ -131,7 +646,22 @@ CalcOutsideSurfTemp(
 );
 
 void
-CalcExteriorVentedCavity( int const SurfNum ); // index of surface
+CalcCTFOutFaceCoupling( Optional_int_const ZoneToResimulate = _ ); // if passed in, then only calculate surfaces that have this zone
+
+void
+CalcOutsideSurfTempBatch();
+
+void
+ReportOutsideSurfRadiation(
+	int const SurfNum, // Surface number
+	Real64 const TempExt // Exterior temperature boundary condition
+);
+
+void
+ReportOutsideSurfConvection( int const SurfNum ); // Surface number
+
+void
+CalcExteriorVentedCavity( int const CavNum ); // index of exterior vented cavity
 
 void
 GatherComponentLoadsSurfAbsFact();
@@ -0,0 +1,371 @@
+// C++ Headers
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Standalone program, not part of the EnergyPlus library: it only reads and writes input files.
+//
+//   ScalingInputGenerator <input idf> <output idf> <tiles in x> <tiles in y> [gap {m}] [csv file]
+//
+// Writes a copy of the input file whose building is tiled NX by NY times, for the heat balance
+// scaling study of Output:HeatBalanceScaling.  Running the outputs of several tilings collects one
+// CSV row per environment and tiling in the same file.
+
+namespace EnergyPlus {
+
+namespace ScalingInputGenerator {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Generates inputs of growing size from one building, so that the cost of input processing and
+	// of the surface heat balance loops can be measured against the numbers of zones, surfaces,
+	// windows and green roof surfaces.
+
+	// METHODOLOGY EMPLOYED:
+	// The input file is copied unchanged.  For every tile but the first, copies of its Zone,
+	// BuildingSurface:Detailed and FenestrationSurface:Detailed objects are added with "_T<i>_<j>"
+	// appended to their names and to the zone, base surface and adjacent surface or zone names they
+	// refer to.  The tiles are laid out on a grid whose pitch is the plan extent of the building
+	// plus a gap.  With relative coordinates the zone origins are moved; with world coordinates the
+	// vertices are.  The extent is taken from the vertices plus the zone origins; zone rotations
+	// are ignored, so a generous gap should be used for a building with rotated zones.
+	// Constructions, schedules and the Material:RoofVegetation object are shared by all tiles:
+	// the green roof model allows only one vegetation material per run, so vegetated roof surfaces
+	// are replicated while the material is not.  Internal gains, internal mass, daylighting and
+	// HVAC objects are not replicated; the added zones are unconditioned.
+	// The Output:HeatBalanceScaling object of the input, or a new one, gets "<NX>x<NY>" as its case
+	// name so that the rows of each tiling can be told apart.
+
+	// REFERENCES:
+	// na
+
+	// Data
+	// DERIVED TYPE DEFINITIONS:
+
+	// One object of an input file
+	struct IdfObject
+	{
+		// Members
+		std::string::size_type Begin; // Offset of the start of the object in the input text
+		std::string::size_type End; // Offset just past its terminating semicolon
+		std::vector< std::string > Fields; // Class name, then the fields, trimmed and without comments
+
+		// Default Constructor
+		IdfObject() :
+			Begin( 0 ),
+			End( 0 )
+		{}
+
+	};
+
+	// Functions
+
+	std::string
+	UpperCase( std::string const & String ) // String to convert
+	{
+		std::string Upper( String );
+		for ( auto & Character : Upper ) Character = std::toupper( static_cast< unsigned char >( Character ) );
+		return Upper;
+	}
+
+	std::string
+	Trimmed( std::string const & String ) // String to trim
+	{
+		std::string::size_type const First( String.find_first_not_of( " \t\r\n" ) );
+		if ( First == std::string::npos ) return "";
+		return String.substr( First, String.find_last_not_of( " \t\r\n" ) - First + 1 );
+	}
+
+	void
+	ReadIdfObjects(
+		std::string const & Text, // Contents of the input file
+		std::vector< IdfObject > & Objects // Objects found in it
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Splits an input file into objects and fields.
+
+		// METHODOLOGY EMPLOYED:
+		// "!" starts a comment that runs to the end of the line; fields end at a comma and objects at
+		// a semicolon.  The text offsets of each object are kept so that it can be left out of the copy.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		IdfObject Object; // Object being read
+		std::string Field; // Field being read
+		bool InObject( false ); // True once the class name of an object has started
+
+		// FLOW:
+		for ( std::string::size_type Pos = 0; Pos < Text.size(); ++Pos ) {
+			char const Character( Text[ Pos ] );
+			if ( Character == '!' ) {
+				Pos = Text.find( '\n', Pos );
+				if ( Pos == std::string::npos ) break;
+				continue;
+			}
+			if ( ! InObject ) {
+				if ( std::isspace( static_cast< unsigned char >( Character ) ) ) continue;
+				InObject = true;
+				Object.Begin = Pos;
+			}
+			if ( Character == ',' || Character == ';' ) {
+				Object.Fields.push_back( Trimmed( Field ) );
+				Field.clear();
+				if ( Character == ';' ) {
+					Object.End = Pos + 1;
+					Objects.push_back( Object );
+					Object = IdfObject();
+					InObject = false;
+				}
+			} else {
+				Field += Character;
+			}
+		}
+
+	}
+
+	std::string
+	FieldValue(
+		IdfObject const & Object, // Object to look in
+		std::vector< std::string >::size_type const FieldNum // Field number, 1 = first field after the class name
+	)
+	{
+		return ( FieldNum < Object.Fields.size() ) ? Object.Fields[ FieldNum ] : "";
+	}
+
+	double
+	FieldNumber(
+		IdfObject const & Object, // Object to look in
+		std::vector< std::string >::size_type const FieldNum // Field number, 1 = first field after the class name
+	)
+	{
+		// Blank and non-numeric fields (autocalculate) count as 0, the input processor's default for these fields
+		return std::atof( FieldValue( Object, FieldNum ).c_str() );
+	}
+
+	std::string
+	FormatNumber( double const Value ) // Number to write to the input file
+	{
+		std::ostringstream Stream;
+		Stream << std::fixed << std::setprecision( 4 ) << Value;
+		return Stream.str();
+	}
+
+	void
+	WriteIdfObject(
+		std::ostream & Output, // File the object is written to
+		std::vector< std::string > const & Fields // Class name, then the fields
+	)
+	{
+		Output << "  " << Fields[ 0 ];
+		for ( std::vector< std::string >::size_type FieldNum = 1; FieldNum < Fields.size(); ++FieldNum ) {
+			Output << ",\n    " << Fields[ FieldNum ];
+		}
+		Output << ";\n\n";
+	}
+
+	int
+	GenerateTiledInput(
+		std::string const & InputFileName, // Input file with the building to tile
+		std::string const & OutputFileName, // Tiled input file to write
+		int const NumTilesX, // Number of tiles in the x direction
+		int const NumTilesY, // Number of tiles in the y direction
+		double const Gap, // Space between neighbouring tiles [m]
+		std::string const & ScalingFileName // CSV file for a new Output:HeatBalanceScaling object
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the tiled copy of an input file (see the module methodology); returns the exit
+		// status of the program.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::string Text; // Contents of the input file
+		std::vector< IdfObject > Objects; // Objects of the input file
+		std::unordered_map< std::string, std::pair< double, double > > ZoneOrigin; // X and Y origin of each zone, by upper case name
+		bool WorldCoordinates( false ); // True if vertices are given in world coordinates
+		bool HaveExtent( false ); // True once a vertex has been seen
+		double MinX( 0.0 ), MaxX( 0.0 ), MinY( 0.0 ), MaxY( 0.0 ); // Plan extent of the building [m]
+		IdfObject const * ScalingObject( nullptr ); // Output:HeatBalanceScaling object of the input
+		int NumZones( 0 ), NumSurfaces( 0 ), NumWindows( 0 ); // Objects replicated per tile
+
+		// FLOW:
+		std::ifstream InputFile( InputFileName, std::ios::binary );
+		if ( ! InputFile ) {
+			std::cerr << "ScalingInputGenerator: Could not open file \"" << InputFileName << "\" for input (read)." << std::endl;
+			return EXIT_FAILURE;
+		}
+		std::ostringstream Contents;
+		Contents << InputFile.rdbuf();
+		Text = Contents.str();
+		ReadIdfObjects( Text, Objects );
+
+		for ( auto const & Object : Objects ) {
+			std::string const ClassName( UpperCase( Object.Fields[ 0 ] ) );
+			if ( ClassName == "GLOBALGEOMETRYRULES" ) {
+				std::string const CoordinateSystem( UpperCase( FieldValue( Object, 3 ) ) );
+				WorldCoordinates = ( CoordinateSystem == "WORLD" || CoordinateSystem == "ABSOLUTE" );
+			} else if ( ClassName == "ZONE" ) {
+				ZoneOrigin[ UpperCase( FieldValue( Object, 1 ) ) ] = std::make_pair( FieldNumber( Object, 3 ), FieldNumber( Object, 4 ) );
+				++NumZones;
+			} else if ( ClassName == "FENESTRATIONSURFACE:DETAILED" ) {
+				++NumWindows;
+			} else if ( ClassName == "OUTPUT:HEATBALANCESCALING" ) {
+				ScalingObject = &Object;
+			}
+		}
+
+		for ( auto const & Object : Objects ) {
+			if ( UpperCase( Object.Fields[ 0 ] ) != "BUILDINGSURFACE:DETAILED" ) continue;
+			++NumSurfaces;
+			double OriginX( 0.0 ), OriginY( 0.0 );
+			if ( ! WorldCoordinates ) {
+				auto const Origin( ZoneOrigin.find( UpperCase( FieldValue( Object, 4 ) ) ) );
+				if ( Origin != ZoneOrigin.end() ) {
+					OriginX = Origin->second.first;
+					OriginY = Origin->second.second;
+				}
+			}
+			for ( std::vector< std::string >::size_type FieldNum = 11; FieldNum + 2 < Object.Fields.size(); FieldNum += 3 ) {
+				double const X( OriginX + FieldNumber( Object, FieldNum ) );
+				double const Y( OriginY + FieldNumber( Object, FieldNum + 1 ) );
+				if ( ! HaveExtent ) {
+					MinX = MaxX = X;
+					MinY = MaxY = Y;
+					HaveExtent = true;
+				}
+				MinX = std::min( MinX, X );
+				MaxX = std::max( MaxX, X );
+				MinY = std::min( MinY, Y );
+				MaxY = std::max( MaxY, Y );
+			}
+		}
+		if ( ! HaveExtent ) {
+			std::cerr << "ScalingInputGenerator: File \"" << InputFileName << "\" has no BuildingSurface:Detailed objects to tile." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		std::ofstream OutputFile( OutputFileName, std::ios::binary );
+		if ( ! OutputFile ) {
+			std::cerr << "ScalingInputGenerator: Could not open file \"" << OutputFileName << "\" for output (write)." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// The input, less its Output:HeatBalanceScaling object, which is written again with the case name
+		if ( ScalingObject != nullptr ) {
+			OutputFile << Text.substr( 0, ScalingObject->Begin ) << Text.substr( ScalingObject->End );
+		} else {
+			OutputFile << Text;
+		}
+
+		double const PitchX( MaxX - MinX + Gap ); // Distance between tile origins [m]
+		double const PitchY( MaxY - MinY + Gap );
+		std::string const CaseName( std::to_string( NumTilesX ) + 'x' + std::to_string( NumTilesY ) );
+		OutputFile << "\n! Building tiled " << CaseName << " by ScalingInputGenerator: " << NumZones << " zones, " << NumSurfaces << " surfaces and " << NumWindows << " windows per tile\n\n";
+
+		for ( int TileY = 1; TileY <= NumTilesY; ++TileY ) {
+			for ( int TileX = 1; TileX <= NumTilesX; ++TileX ) {
+				if ( TileX == 1 && TileY == 1 ) continue; // The original building
+				std::string const Suffix( "_T" + std::to_string( TileX ) + '_' + std::to_string( TileY ) );
+				double const OffsetX( ( TileX - 1 ) * PitchX );
+				double const OffsetY( ( TileY - 1 ) * PitchY );
+				for ( auto const & Object : Objects ) {
+					std::string const ClassName( UpperCase( Object.Fields[ 0 ] ) );
+					std::vector< std::string > Fields( Object.Fields );
+					std::vector< std::string >::size_type FirstVertexField( 0 ); // 0 = no vertices to move
+					if ( ClassName == "ZONE" ) {
+						Fields.resize( std::max( Fields.size(), std::vector< std::string >::size_type( 5 ) ) );
+						Fields[ 1 ] += Suffix;
+						if ( ! WorldCoordinates ) {
+							Fields[ 3 ] = FormatNumber( FieldNumber( Object, 3 ) + OffsetX );
+							Fields[ 4 ] = FormatNumber( FieldNumber( Object, 4 ) + OffsetY );
+						}
+					} else if ( ClassName == "BUILDINGSURFACE:DETAILED" ) {
+						Fields[ 1 ] += Suffix;
+						Fields[ 4 ] += Suffix;
+						std::string const OutsideBoundaryCondition( UpperCase( FieldValue( Object, 5 ) ) );
+						if ( ( OutsideBoundaryCondition == "SURFACE" || OutsideBoundaryCondition == "ZONE" ) && Fields.size() > 6 ) Fields[ 6 ] += Suffix;
+						FirstVertexField = 11;
+					} else if ( ClassName == "FENESTRATIONSURFACE:DETAILED" ) {
+						Fields[ 1 ] += Suffix;
+						Fields[ 4 ] += Suffix;
+						if ( ! FieldValue( Object, 5 ).empty() ) Fields[ 5 ] += Suffix;
+						FirstVertexField = 11;
+					} else {
+						continue;
+					}
+					if ( WorldCoordinates && FirstVertexField > 0 ) {
+						for ( auto FieldNum = FirstVertexField; FieldNum + 2 < Fields.size(); FieldNum += 3 ) {
+							Fields[ FieldNum ] = FormatNumber( FieldNumber( Object, FieldNum ) + OffsetX );
+							Fields[ FieldNum + 1 ] = FormatNumber( FieldNumber( Object, FieldNum + 1 ) + OffsetY );
+						}
+					}
+					WriteIdfObject( OutputFile, Fields );
+				}
+			}
+		}
+
+		std::vector< std::string > ScalingFields( 3 );
+		ScalingFields[ 0 ] = "Output:HeatBalanceScaling";
+		ScalingFields[ 1 ] = ( ScalingObject != nullptr ) ? FieldValue( *ScalingObject, 1 ) : ScalingFileName;
+		ScalingFields[ 2 ] = CaseName;
+		WriteIdfObject( OutputFile, ScalingFields );
+
+		OutputFile.close();
+		if ( OutputFile.fail() ) {
+			std::cerr << "ScalingInputGenerator: Error writing file \"" << OutputFileName << "\"." << std::endl;
+			return EXIT_FAILURE;
+		}
+		return EXIT_SUCCESS;
+
+	}
+
+} // ScalingInputGenerator
+
+} // EnergyPlus
+
+int
+main(
+	int argc,
+	char * argv[]
+)
+{
+	using EnergyPlus::ScalingInputGenerator::GenerateTiledInput;
+
+	if ( argc < 5 || argc > 7 ) {
+		std::cerr << "Usage: ScalingInputGenerator <input idf> <output idf> <tiles in x> <tiles in y> [gap {m}, default 10] [csv file, default HeatBalanceScaling.csv]" << std::endl;
+		return EXIT_FAILURE;
+	}
+	int const NumTilesX( std::atoi( argv[ 3 ] ) );
+	int const NumTilesY( std::atoi( argv[ 4 ] ) );
+	double const Gap( ( argc > 5 ) ? std::atof( argv[ 5 ] ) : 10.0 );
+	if ( NumTilesX < 1 || NumTilesY < 1 || Gap < 0.0 ) {
+		std::cerr << "ScalingInputGenerator: The tile counts must be at least 1 and the gap cannot be negative." << std::endl;
+		return EXIT_FAILURE;
+	}
+	return GenerateTiledInput( argv[ 1 ], argv[ 2 ], NumTilesX, NumTilesY, Gap, ( argc > 6 ) ? argv[ 6 ] : "HeatBalanceScaling.csv" );
+}